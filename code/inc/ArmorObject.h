@@ -13,6 +13,7 @@ class ArmorObject : public GameObject
 public:
     // Constructors
     ArmorObject(const Sean::String aName, const Sean::String aDescription, int aArmor, ObjectType aType, int aID);
+    ArmorObject(const ObjectValue &aValue);
     ArmorObject(const ArmorObject &other);
     ArmorObject(ArmorObject &&other) noexcept;
 
@@ -30,13 +31,6 @@ public:
     int getValue() const override;
     int getMin() const override;
     int getMax() const override;
-
-private:
-    // Private Methods
-    void swap(ArmorObject &other) noexcept;
-
-    // Members
-    int mArmor; ///< The armor value of the object.
 };
 
 #endif // ARMOROBJECT_H
\ No newline at end of file
@@ -0,0 +1,231 @@
+#ifndef BINARYFORMAT_H
+#define BINARYFORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief On-disk layout of a compiled dungeon file and of a saved game.
+ *
+ * A file consists of a Header followed by, in order and without gaps:
+ *  - uint32_t atom offsets[mAtomCount]
+ *  - char atom characters[mCharCount] (null-terminated atoms, padded to a multiple of 4)
+ *  - DungeonLayout::Room rooms[mRoomCount]
+ *  - uint32_t exits[mRoomCount * 4] (room index per direction, 0xFFFFFFFF for none)
+ *  - uint32_t lists[mListCount] (enemy, visible and hidden object atoms per room)
+ *
+ * A saved game consists of a SaveHeader followed by the arrays of a compiled dungeon (without its
+ * header) and then the game state, each part described at SaveHeader. Strings are stored as a
+ * uint32_t length followed by the characters, objects as ObjectRecord followed by their name and
+ * description.
+ *
+ * A recorded session consists of a SessionHeader followed by the records described there, an
+ * event log of an EventHeader followed by the events described there.
+ *
+ * All values are stored little-endian, the first room is the start room.
+ */
+namespace BinaryFormat
+{
+    /**
+     * @brief Magic bytes at the start of every compiled dungeon.
+     */
+    constexpr char Magic[4] = {'K', 'E', 'R', 'K'};
+
+    /**
+     * @brief Version of the format, increased on every incompatible change.
+     */
+    constexpr uint32_t Version = 1;
+
+    /**
+     * @brief Struct representing the file header.
+     */
+    struct Header
+    {
+        char mMagic[4];      ///< Always Magic.
+        uint32_t mVersion;   ///< Always Version.
+        uint32_t mRoomCount; ///< Number of rooms.
+        uint32_t mAtomCount; ///< Number of atoms.
+        uint32_t mCharCount; ///< Size of the padded character pool.
+        uint32_t mListCount; ///< Number of list entries.
+    };
+
+    /**
+     * @brief Magic bytes at the start of every saved game.
+     */
+    constexpr char SaveMagic[4] = {'K', 'S', 'A', 'V'};
+
+    /**
+     * @brief Version of the saved game format, increased on every incompatible change.
+     */
+    constexpr uint32_t SaveVersion = 4;
+
+    /**
+     * @brief Marker for an index that is not set, such as an empty equipment slot.
+     */
+    constexpr uint32_t NoIndex = 0xFFFFFFFF;
+
+    /**
+     * @brief Struct representing the header of a saved game.
+     *
+     * The layout arrays are followed by:
+     *  - uint8_t spawned[mRoomCount] (whether the enemies of each room were spawned)
+     *  - uint32_t touched rooms[mTouchedCount]
+     *  - mEntityCount entities: EntityRecord and name, which gives the kind on load
+     *  - mRoomIndexCount room entries: room index, entity count and entity IDs in order of arrival
+     *  - mLocationCount locations: room index, visible count, visible objects, hidden count, hidden objects
+     *  - PlayerRecord, player name and mInventoryCount objects
+     */
+    struct SaveHeader
+    {
+        char mMagic[4];             ///< Always SaveMagic.
+        uint32_t mVersion;          ///< Always SaveVersion.
+        Header mLayout;             ///< Sizes of the layout arrays, its magic and version are unused.
+        uint64_t mSeed;             ///< Seed of the enemy movement.
+        uint32_t mTurn;             ///< Number of enemy turns that have passed.
+        uint32_t mCurrentRoom;      ///< Room index of the player.
+        int32_t mMaterializeRadius; ///< Number of hops around the player in which rooms are materialized.
+        uint32_t mActiveSimulation; ///< 1 if only the enemies around the player are simulated.
+        uint32_t mTouchedCount;     ///< Number of rooms that may not be evicted.
+        uint32_t mEntityCount;      ///< Number of enemies.
+        uint32_t mRoomIndexCount;   ///< Number of rooms with enemies.
+        uint32_t mLocationCount;    ///< Number of materialized rooms.
+        uint32_t mInventoryCount;   ///< Number of objects carried by the player.
+    };
+
+    /**
+     * @brief Struct representing the fixed part of a saved enemy.
+     */
+    struct EntityRecord
+    {
+        int32_t mNumber;         ///< Number shown after the name.
+        int32_t mHealth;         ///< Health.
+        int32_t mAttackPercent;  ///< Chance to hit, in percent.
+        int32_t mMinimumDamage;  ///< Minimum damage of a hit.
+        int32_t mMaximumDamage;  ///< Maximum damage of a hit.
+        uint32_t mPosition;      ///< Room index.
+        uint32_t mLastSimulated; ///< Turn up to which the enemy was simulated.
+        uint32_t mLootSeed;      ///< Seed the loot is rolled with.
+        uint32_t mLootPending;   ///< 1 if the loot from the loot table of the enemy was not taken yet.
+    };
+
+    /**
+     * @brief Struct representing the fixed part of a saved object.
+     */
+    struct ObjectRecord
+    {
+        uint32_t mType;   ///< The ObjectType.
+        int32_t mId;      ///< ID shown after the name.
+        int32_t mMinimum; ///< Minimum value, or the armor value.
+        int32_t mMaximum; ///< Maximum value, or the armor value.
+    };
+
+    /**
+     * @brief Struct representing the fixed part of the saved player.
+     */
+    struct PlayerRecord
+    {
+        int32_t mHealth;           ///< Health.
+        int32_t mAttackPercentage; ///< Chance to hit, in percent.
+        int32_t mGold;             ///< Gold.
+        uint32_t mGodMode;         ///< 1 if god mode is on.
+        uint32_t mEquippedWeapon;  ///< Inventory index of the equipped weapon, or NoIndex.
+        uint32_t mEquippedArmor;   ///< Inventory index of the equipped armor, or NoIndex.
+    };
+
+    /**
+     * @brief Magic bytes at the start of every recorded session.
+     */
+    constexpr char SessionMagic[4] = {'K', 'S', 'E', 'S'};
+
+    /**
+     * @brief Version of the recorded session format, increased on every incompatible change.
+     */
+    constexpr uint32_t SessionVersion = 1;
+
+    /**
+     * @brief Kinds of record in a recorded session.
+     */
+    enum class SessionRecord : uint8_t
+    {
+        Source, ///< The dungeon the session was played in.
+        Input,  ///< A line of input.
+    };
+
+    /**
+     * @brief Kinds of dungeon a session can be played in.
+     */
+    enum class SessionSource : uint8_t
+    {
+        None,      ///< No dungeon was chosen yet.
+        Loaded,    ///< A dungeon loaded from an XML or compiled file.
+        Generated, ///< A randomly generated dungeon.
+    };
+
+    /**
+     * @brief Struct representing the header of a recorded session.
+     *
+     * The header is followed by records, each a uint8_t SessionRecord and a uint32_t size followed
+     * by that many bytes:
+     *  - Source: uint8_t SessionSource followed by the path of the loaded dungeon or the number of
+     *    generated locations as text
+     *  - Input: a line of input as it was read, including its line break
+     *
+     * Records are appended while the session is played, so the file is usable up to the last
+     * complete line even if the game is killed.
+     */
+    struct SessionHeader
+    {
+        char mMagic[4];    ///< Always SessionMagic.
+        uint32_t mVersion; ///< Always SessionVersion.
+        uint64_t mSeed;    ///< Seed of the RandomGenerator, every other seed is drawn from it.
+    };
+
+    /**
+     * @brief Magic bytes at the start of every event log.
+     */
+    constexpr char EventMagic[4] = {'K', 'E', 'V', 'T'};
+
+    /**
+     * @brief Version of the event log format, increased on every incompatible change.
+     */
+    constexpr uint32_t EventVersion = 1;
+
+    /**
+     * @brief Kinds of event in an event log.
+     */
+    enum class EventType : uint8_t
+    {
+        Command, ///< The player entered a command: command line.
+        Move,    ///< The player moved: room index from, room index to.
+        Attack,  ///< The player attacked an enemy: enemy name, damage.
+        Damage,  ///< An enemy attacked the player: enemy name, damage.
+        Pickup,  ///< The player picked up an object: object name.
+        Death,   ///< An enemy or the player died: name.
+        Score,   ///< The game ended with a score: player name, gold.
+        Count,   ///< Number of kinds of event, not an event.
+    };
+
+    /**
+     * @brief Fields of each kind of event: 'u' for an unsigned varint, 'i' for a zigzag encoded
+     * signed varint and 's' for a varint length followed by that many characters.
+     */
+    constexpr const char *EventFields[static_cast<size_t>(EventType::Count)] = {"s", "uu", "si", "si", "s", "s", "si"};
+
+    /**
+     * @brief Struct representing the header of an event log.
+     *
+     * The header is followed by events, each a varint EventType, a varint number of microseconds
+     * since the previous event (or since mStartTime for the first) and the fields of its kind.
+     * Varints store 7 bits per byte, least significant first, with the high bit set on every
+     * byte but the last.
+     */
+    struct EventHeader
+    {
+        char mMagic[4];      ///< Always EventMagic.
+        uint32_t mVersion;   ///< Always EventVersion.
+        uint64_t mStartTime; ///< Microseconds since the Unix epoch when the log was opened.
+    };
+
+} // namespace BinaryFormat
+
+#endif // BINARYFORMAT_H
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef BINARYREADER_H
+#define BINARYREADER_H
+
+#include "DungeonLayout.h"
+
+/**
+ * @class BinaryReader
+ * @brief A class to read a compiled dungeon file.
+ *
+ * The file is memory-mapped and copied into a DungeonLayout in bulk, no text is parsed.
+ */
+class BinaryReader
+{
+public:
+    BinaryReader(const char *aPath);
+    const DungeonLayout &getLayout() const;
+
+    static bool isBinaryFile(const char *aPath);
+
+private:
+    DungeonLayout mLayout; ///< The layout read from the file.
+};
+
+#endif // BINARYREADER_H
\ No newline at end of file
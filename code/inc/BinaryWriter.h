@@ -0,0 +1,22 @@
+#ifndef BINARYWRITER_H
+#define BINARYWRITER_H
+
+#include "DungeonLayout.h"
+
+#include <string>
+
+/**
+ * @class BinaryWriter
+ * @brief A class to write a DungeonLayout as a compiled dungeon file.
+ */
+class BinaryWriter
+{
+public:
+    BinaryWriter(const char *aPath);
+    void write(const DungeonLayout &aLayout) const;
+
+private:
+    std::string mPath; ///< Path of the file to write.
+};
+
+#endif // BINARYWRITER_H
\ No newline at end of file
@@ -12,6 +12,7 @@ class ConsumableObject : public GameObject
 public:
     // Constructors
     ConsumableObject(const Sean::String aName, const Sean::String aDescription, int aMinimum, int aMaximum, ObjectType aType, int aID);
+    ConsumableObject(const ObjectValue &aValue);
     ConsumableObject(const ConsumableObject &other);
     ConsumableObject(ConsumableObject &&other) noexcept;
 
@@ -28,21 +29,6 @@ public:
     int getValue() const override;
     int getMin() const override;
     int getMax() const override;
-
-private:
-    // Private Methods
-    void swap(ConsumableObject &other) noexcept;
-
-private:
-    /**
-     * @brief The minimum value of the consumable object.
-     */
-    int mMinimum;
-
-    /**
-     * @brief The maximum value of the consumable object.
-     */
-    int mMaximum;
 };
 
 #endif // CONSUMABLEOBJECT_H
\ No newline at end of file
@@ -4,18 +4,44 @@
 #include "Sean.h"
 #include "Location.h"
 #include "WeaponObject.h"
+#include "DungeonLayout.h"
+#include "RoomGraph.h"
+#include "EntityStore.h"
+#include "MovementScheduler.h"
+#include "Pathfinder.h"
+#include "EventLog.h"
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 /**
  * @class Dungeon
  * @brief A class representing a dungeon in the game.
- * 
+ *
  * This class manages the locations, objects, and enemies within a dungeon.
+ * Every room is kept in compact form in a DungeonLayout; a room only becomes a full
+ * Location when the player comes within a few hops of it.
+ *
+ * Copies and forks of a dungeon share the layout, the exits and the materialized rooms. The layout
+ * never changes, the exits and each room are copied by the dungeon that changes them, the first
+ * time it does so.
+ *
+ * A dungeon only records its events when it is given an event log. Copies and forks never get the
+ * log of the dungeon they come from, so a look ahead does not show up as something that happened.
  */
 class Dungeon
 {
 public:
+    /**
+     * @brief Default number of hops around the player in which rooms are materialized.
+     */
+    static constexpr int DefaultMaterializeRadius = 2;
+
     // Constructors
     Dungeon(Sean::Vector<Sean::ParsedLocations> &aLocations);
+    Dungeon(DungeonLayout aLayout);
     Dungeon(int aLocations);
     Dungeon(const Dungeon& other); // Copy constructor
     Dungeon& operator=(const Dungeon& other); // Copy assignment operator
@@ -26,10 +52,11 @@ public:
     virtual ~Dungeon() = default;
 
     // Methods
+    std::unique_ptr<Dungeon> fork() const;
     int update();
     GameObject* createGameObject(const Sean::String &aName);
-    GameObject* pickUpObject(const char *aObjectName);
-    void placeObject(GameObject *aObject);
+    bool pickUpObject(const char *aObjectName, ObjectValue &aObject);
+    void placeObject(const ObjectValue &aObject);
     void printShortDescription() const;
     void printLongDescription() const;
     bool validLocation(Sean::Direction aDirection) const;
@@ -39,21 +66,107 @@ public:
     void teleport(int aAmount);
     bool attackEnemy(const char *aEnemyName, int aDamage);
     const Location& getCurrentLocation() const;
+    uint32_t getCurrentRoom() const;
+    const EntityStore& getEntities() const;
+    void setMaterializeRadius(int aHops);
+    size_t getMaterializedCount() const;
+    void setActiveSimulation(bool aEnabled);
+    uint32_t getTurn() const;
+    bool findRoute(const char *aLocationName, std::vector<Sean::Direction> &aRoute);
+    uint32_t getDistance(uint32_t aFrom, uint32_t aTo);
+    uint32_t getNextStep(uint32_t aFrom, uint32_t aTo);
+    void setExit(uint32_t aRoom, Sean::Direction aDirection, uint32_t aTarget);
+    void setEventLog(EventLog *aEventLog);
 
 private:
+    friend class SaveGame;
+
+    // Private Constructors
+    Dungeon();
+
     // Private Methods
     void moveEnemies();
+    void enterRoom(uint32_t aRoom);
+    Location *materialize(uint32_t aRoom);
+    Location *editCurrentLocation();
+    void updateRegion();
+    void printEnemies() const;
 
 private:
     /**
-     * @brief The map of the dungeon, containing all locations.
+     * @brief Compact form of every room in the dungeon without its exits, never changed and shared with every fork.
+     */
+    std::shared_ptr<const DungeonLayout> mLayout;
+
+    /**
+     * @brief The only copy of the exits between the rooms, by room index, shared with forks until an exit changes.
+     */
+    std::shared_ptr<RoomGraph> mGraph;
+
+    /**
+     * @brief The rooms that currently exist as a full Location, by room index, shared with forks until changed.
      */
-    Sean::Vector<Location> mMap; //unordered_map would be way better!!!!!!!!!!
+    std::unordered_map<uint32_t, std::shared_ptr<Location>> mMap;
+
+    /**
+     * @brief The enemies of the whole dungeon, rooms refer to them by entity ID.
+     */
+    EntityStore mEntities;
+
+    /**
+     * @brief Plans and applies the enemy moves of a turn.
+     */
+    MovementScheduler mScheduler;
+
+    /**
+     * @brief Finds routes between rooms from cached distance fields.
+     */
+    Pathfinder mPathfinder;
+
+    /**
+     * @brief Per room, whether its enemies were added to mEntities already.
+     */
+    std::vector<bool> mSpawnedRooms;
+
+    /**
+     * @brief Rooms that differ from their compact form and may never be evicted.
+     */
+    std::unordered_set<uint32_t> mTouchedRooms;
+
+    /**
+     * @brief Number of hops around the player in which rooms are materialized.
+     */
+    int mMaterializeRadius;
+
+    /**
+     * @brief The rooms within the materialize radius, in which enemies are simulated.
+     */
+    std::vector<uint32_t> mActiveRooms;
+
+    /**
+     * @brief Whether only the enemies in mActiveRooms are simulated.
+     */
+    bool mActiveSimulation;
+
+    /**
+     * @brief Number of enemy turns that have passed.
+     */
+    uint32_t mTurn;
+
+    /**
+     * @brief The room index of the player.
+     */
+    uint32_t mCurrentRoom;
 
     /**
      * @brief The current location of the player in the dungeon.
      */
     Location *mCurrentLocation;
+
+    /**
+     * @brief The log the move, attack, damage and death events are recorded in, or nullptr to record nothing.
+     */
+    EventLog *mEventLog;
 };
 
 #endif // DUNGEON_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define DUNGEONFACADE_H
 
 #include "Dungeon.h"
+#include "Player.h"
 #include "Sean.h"
 #include "IGameObject.h"
 
@@ -26,12 +27,13 @@ public:
 
     // Methods
     void createDungeon(std::vector<Sean::ParsedLocations> &aLocations);
+    void createDungeon(const DungeonLayout &aLayout);
     void generateDungeon(int aLocations);
     void printLongDescription() const;
     void printShortDescription() const;
     void moveHiddenObjects();
-    IGameObject *pickUpObject(const char *aObjectName);
-    bool placeObject(std::unique_ptr<IGameObject> aObject);
+    bool pickUpObject(const char *aObjectName, ObjectValue &aObject);
+    bool placeObject(const ObjectValue &aObject);
     bool printGameObject(const char *aObjectName) const;
     bool printEnemy(const char *aEnemyName) const;
     bool validLocation(Sean::Direction aDirection) const;
@@ -40,6 +42,9 @@ public:
     IGameObject *createGameObject(const Sean::String &aName);
     int update();
     void teleport(int aAmount);
+    bool findRoute(const char *aLocationName, std::vector<Sean::Direction> &aRoute);
+    void saveGame(const char *aPath, const Player &aPlayer) const;
+    void loadGame(const char *aPath, Player &aPlayer);
 
 private:
     // Private Methods
@@ -0,0 +1,85 @@
+#ifndef DUNGEONGENERATOR_H
+#define DUNGEONGENERATOR_H
+
+#include "DungeonLayout.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @class DungeonGenerator
+ * @brief Generates large random dungeons as a DungeonLayout.
+ *
+ * Rooms are laid out on a grid. A spanning tree over the grid (every room connects to its
+ * northern or western neighbour) guarantees that every room can be reached from the start
+ * room, and extra grid edges are added as loops. Exits always follow the grid, so every exit
+ * has a matching exit back. The database is only read once for its catalog of names; rooms
+ * are then populated in parallel from per-room random streams and named without repeats.
+ */
+class DungeonGenerator
+{
+public:
+    /**
+     * @brief Maximum number of visible and of hidden objects per room.
+     */
+    static constexpr uint32_t MaxObjectsPerRoom = 3;
+
+    /**
+     * @brief Struct holding the settings of a generated dungeon.
+     */
+    struct Settings
+    {
+        uint32_t mRoomCount;       ///< Number of rooms to generate.
+        int mLoopPercent;          ///< Chance that a grid edge outside the spanning tree becomes an exit.
+        int mEnemyPercent;         ///< Chance that a room has an enemy.
+        int mVisibleObjectPercent; ///< Chance per slot that a room has a visible object.
+        int mHiddenObjectPercent;  ///< Chance per slot that a room has a hidden object.
+        uint64_t mSeed;            ///< Seed of all random streams.
+        unsigned mThreadCount;     ///< Number of threads used to populate the rooms.
+
+        Settings(uint32_t aRoomCount);
+    };
+
+    /**
+     * @brief Struct holding the duration of a generation phase.
+     */
+    struct PhaseTiming
+    {
+        const char *mName;    ///< Name of the phase.
+        double mMilliseconds; ///< Duration of the phase.
+    };
+
+    // Constructors
+    DungeonGenerator(const Settings &aSettings);
+
+    // Destructor
+    virtual ~DungeonGenerator() = default;
+
+    // Methods
+    DungeonLayout generate();
+    const std::vector<PhaseTiming> &getTimings() const;
+
+private:
+    // Private Methods
+    void loadCatalog(DungeonLayout &aLayout);
+    void buildExits(DungeonLayout &aLayout) const;
+    void populateRooms(DungeonLayout &aLayout) const;
+    void nameRooms(DungeonLayout &aLayout) const;
+    void parallelFor(size_t aCount, const std::function<void(size_t, size_t)> &aBody) const;
+    bool connectsNorth(uint32_t aRoom) const;
+    bool hasEastEdge(uint32_t aRoom) const;
+    bool hasSouthEdge(uint32_t aRoom) const;
+
+private:
+    // Members
+    Settings mSettings;                         ///< The settings of the dungeon.
+    uint32_t mWidth;                            ///< Number of rooms per grid row.
+    std::vector<uint32_t> mLocationNames;       ///< Atoms of the location names in the catalog.
+    std::vector<uint32_t> mLocationDescriptions; ///< Atoms of the matching location descriptions.
+    std::vector<uint32_t> mEnemyNames;          ///< Atoms of the enemy names in the catalog.
+    std::vector<uint32_t> mObjectNames;         ///< Atoms of the object names in the catalog.
+    std::vector<PhaseTiming> mTimings;          ///< Duration of each phase of the last generation.
+};
+
+#endif // DUNGEONGENERATOR_H
\ No newline at end of file
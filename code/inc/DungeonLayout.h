@@ -0,0 +1,99 @@
+#ifndef DUNGEONLAYOUT_H
+#define DUNGEONLAYOUT_H
+
+#include "Sean.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class DungeonLayout
+ * @brief A compact, index-based description of a dungeon.
+ *
+ * Every distinct text (location names, descriptions, enemy and object names) is stored once
+ * as an atom. Rooms reference atoms by index and exits are stored as room indexes, four per
+ * room in direction order. This is the in-memory form of the binary dungeon format.
+ */
+class DungeonLayout
+{
+public:
+    /**
+     * @brief Marker for a missing exit.
+     */
+    static constexpr uint32_t NoRoom = 0xFFFFFFFF;
+
+    /**
+     * @brief Number of exits stored per room.
+     */
+    static constexpr uint32_t ExitsPerRoom = 4;
+
+    /**
+     * @brief Struct representing a single room of the layout.
+     */
+    struct Room
+    {
+        int32_t mId;            ///< The ID of the location as given in the source.
+        uint32_t mName;         ///< Atom index of the name.
+        uint32_t mDescription;  ///< Atom index of the description.
+        uint32_t mListOffset;   ///< Offset of the first enemy atom in the list array.
+        uint32_t mEnemyCount;   ///< Number of enemies, followed by the visible objects.
+        uint32_t mVisibleCount; ///< Number of visible objects, followed by the hidden objects.
+        uint32_t mHiddenCount;  ///< Number of hidden objects.
+    };
+
+    // Constructors
+    DungeonLayout() = default;
+    DungeonLayout(const std::vector<Sean::ParsedLocations> &aLocations);
+    DungeonLayout(const Sean::Vector<Sean::ParsedLocations> &aLocations);
+
+    // Destructor
+    virtual ~DungeonLayout() = default;
+
+    // Assignment Operators
+    DungeonLayout(const DungeonLayout &) = default;
+    DungeonLayout &operator=(const DungeonLayout &) = default;
+    DungeonLayout(DungeonLayout &&) noexcept = default;
+    DungeonLayout &operator=(DungeonLayout &&) noexcept = default;
+
+    // Methods
+    uint32_t intern(const char *aText);
+    uint32_t addRoom(const Sean::ParsedLocations &aLocation);
+    void setExit(uint32_t aRoom, Sean::Direction aDirection, uint32_t aTarget);
+    size_t getRoomCount() const;
+    size_t getAtomCount() const;
+    const Room &getRoom(uint32_t aRoom) const;
+    const char *getAtom(uint32_t aAtom) const;
+    uint32_t getExit(uint32_t aRoom, Sean::Direction aDirection) const;
+    const uint32_t *getEnemies(uint32_t aRoom) const;
+    const uint32_t *getVisibleObjects(uint32_t aRoom) const;
+    const uint32_t *getHiddenObjects(uint32_t aRoom) const;
+    std::vector<uint32_t> findRooms(const char *aName) const;
+    std::vector<uint32_t> takeExits();
+
+private:
+    // Private Methods
+    void build(const Sean::ParsedLocations *aLocations, size_t aCount);
+    uint32_t appendRoom(const Sean::ParsedLocations &aLocation);
+    void indexNames();
+    void linkRoom(const Sean::ParsedLocations *aLocations, uint32_t aRoom, const std::unordered_map<int, uint32_t> &aRoomById, std::vector<bool> &aReached, std::vector<uint32_t> &aQueue, std::string &aReport);
+    void checkIndexes(const std::string &aContext) const;
+
+private:
+    friend class BinaryReader;
+    friend class BinaryWriter;
+    friend class DungeonGenerator;
+    friend class SaveGame;
+
+    // Members
+    std::vector<uint32_t> mAtomOffsets;                    ///< Offset of each atom in the character pool.
+    std::vector<char> mAtomChars;                          ///< Null-terminated atoms, back to back.
+    std::vector<Room> mRooms;                              ///< All rooms, start room first.
+    std::vector<uint32_t> mExits;                          ///< Room index per direction, ExitsPerRoom per room.
+    std::vector<uint32_t> mLists;                          ///< Enemy and object atoms of all rooms.
+    std::unordered_map<std::string, uint32_t> mAtomLookup; ///< Atom index by text.
+    std::vector<uint32_t> mRoomsByName;                    ///< Room indexes sorted by name atom, then by index.
+};
+
+#endif // DUNGEONLAYOUT_H
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "GameObject.h"
 #include "Sean.h"
 
+#include <cstddef>
+#include <cstdint>
+
 /**
  * @brief Represents an enemy in the game.
  * 
@@ -26,6 +29,10 @@ public:
     Enemy(Enemy &&) noexcept = default;
     Enemy &operator=(Enemy &&) noexcept = default;
 
+    // Allocation
+    static void *operator new(std::size_t aSize);
+    static void operator delete(void *aObject, std::size_t aSize);
+
     // Methods
     Sean::String getName() const;
     void printName() const;
@@ -36,15 +43,15 @@ public:
     int getAttack() const;
 
 private:
-    // Private Methods
-    void initializeHiddenObjects();
+    friend class EntityStore;
 
-private:
     // Members
     Sean::String mName;                                    ///< Name of the enemy
     int mID;                                               ///< ID of the enemy
     Sean::String mDescription;                             ///< Description of the enemy
-    Sean::Vector<Sean::Object<GameObject>> mHiddenObjects; ///< Objects that are hidden in the enemy
+    Sean::Vector<Sean::Object<GameObject>> mHiddenObjects; ///< Objects that are hidden in the enemy besides its loot
+    uint32_t mLootTable;                                   ///< Index of the loot table in LootTables
+    uint32_t mLootSeed;                                    ///< Seed the loot is rolled with when the enemy is searched after its death
     int mHealth;                                           ///< Health of the enemy
     int mAttackPercent;                                    ///< Attack percentage of the enemy
     int mMinimumDamage;                                    ///< Minimum damage the enemy can deal
@@ -2,14 +2,24 @@
 #define ENEMY_FACTORY_H
 
 #include "Enemy.h"
+#include "NameIndex.h"
 #include "Sean.h"
 
+#include <cstdint>
+
+class EntityStore;
+
 /**
  * @brief Factory class for creating Enemy objects.
  */
 class EnemyFactory
 {
 public:
+    /**
+     * @brief Marker for a name that is not an enemy of the Vijanden table.
+     */
+    static constexpr uint32_t NoKind = 0xFFFFFFFF;
+
     // Constructors
     EnemyFactory() = default;
 
@@ -19,11 +29,36 @@ public:
     // Methods
     static Enemy *createEnemy(const Sean::String &aEnemyName);
     static Enemy *createEnemy();
+    static Sean::Vector<Sean::Object<Enemy>> createEnemies(int aCount);
+    static Sean::Vector<Sean::Object<Enemy>> createEnemies(const Sean::Vector<Sean::String> &aNames);
+    static bool spawnEnemies(const char *const *aNames, size_t aCount, EntityStore &aEntities, uint32_t aRoom);
+    static uint32_t findKind(const char *aName);
+    static const Sean::String &getKindName(uint32_t aKind);
+    static const Sean::String &getKindDescription(uint32_t aKind);
 
     static void resetCounter();
+    static void raiseCounter(int aMinimum);
 
 private:
+    /**
+     * @brief Struct holding all rows of the Vijanden table, column by column.
+     */
+    struct Catalog
+    {
+        Sean::Vector<Sean::String> mNames;        ///< Names of the enemies.
+        Sean::Vector<Sean::String> mDescriptions; ///< Descriptions of the enemies.
+        Sean::Vector<int> mHealths;               ///< Health of the enemies.
+        Sean::Vector<int> mAttackPercents;        ///< Attack percentages of the enemies.
+        Sean::Vector<int> mMinDamages;            ///< Minimum damage of the enemies.
+        Sean::Vector<int> mMaxDamages;            ///< Maximum damage of the enemies.
+        Sean::Vector<uint32_t> mLootTables;       ///< Loot table of the enemies, or LootTables::NoLoot.
+        NameIndex mRows;                          ///< Rows by name, the keys point into mNames.
+    };
+
     // Private Methods
+    static const Catalog &getCatalog();
+    static Catalog loadCatalog();
+    static Enemy *createFromCatalog(const Catalog &aCatalog, size_t aRow);
 
     static void incrementCounter();
 
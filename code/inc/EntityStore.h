@@ -0,0 +1,98 @@
+#ifndef ENTITYSTORE_H
+#define ENTITYSTORE_H
+
+#include "Sean.h"
+#include "Enemy.h"
+#include "ObjectValue.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class EntityStore
+ * @brief Dungeon-wide storage for the enemies of a dungeon.
+ *
+ * Every enemy gets a stable entity ID that indexes a set of component arrays: kind, number,
+ * health, attack stats, position and loot. The kind is the row of the enemy in the catalog of
+ * EnemyFactory, so the store holds no names or descriptions and copying it allocates no strings. Rooms only refer to entity IDs, so moving an
+ * enemy updates its position instead of copying it.
+ *
+ * Loot is not stored at all until it is taken: each entity keeps its loot table and seed,
+ * and the objects are rolled when its loot is taken.
+ */
+class EntityStore
+{
+public:
+    /**
+     * @brief Stable identifier of an entity, an index into the component arrays.
+     */
+    using EntityId = uint32_t;
+
+    /**
+     * @brief Marker for an entity that does not exist.
+     */
+    static constexpr EntityId NoEntity = 0xFFFFFFFF;
+
+    /**
+     * @brief Struct holding the attack stats of an entity.
+     */
+    struct AttackStats
+    {
+        int mAttackPercent; ///< Chance to hit, in percent.
+        int mMinimumDamage; ///< Minimum damage of a hit.
+        int mMaximumDamage; ///< Maximum damage of a hit.
+    };
+
+    // Constructors
+    EntityStore() = default;
+
+    // Destructor
+    virtual ~EntityStore() = default;
+
+    // Assignment Operators
+    EntityStore(const EntityStore &) = default;
+    EntityStore &operator=(const EntityStore &) = default;
+    EntityStore(EntityStore &&) noexcept = default;
+    EntityStore &operator=(EntityStore &&) noexcept = default;
+
+    // Methods
+    EntityId addEnemy(uint32_t aKind, int aNumber, int aHealth, const AttackStats &aAttackStats, uint32_t aLootTable, uint32_t aLootSeed, uint32_t aRoom);
+    EntityId addEnemy(Enemy &aEnemy, uint32_t aRoom);
+    size_t getEntityCount() const;
+    Sean::String getName(EntityId aEntity) const;
+    void printName(EntityId aEntity) const;
+    void printDescription(EntityId aEntity) const;
+    bool isDead(EntityId aEntity) const;
+    int getHealth(EntityId aEntity) const;
+    void takeDamage(EntityId aEntity, int aDamage);
+    int getAttack(EntityId aEntity) const;
+    const AttackStats &getAttackStats(EntityId aEntity) const;
+    uint32_t getPosition(EntityId aEntity) const;
+    void setPosition(EntityId aEntity, uint32_t aRoom);
+    uint32_t getLastSimulated(EntityId aEntity) const;
+    void setLastSimulated(EntityId aEntity, uint32_t aTurn);
+    const std::vector<EntityId> &getEntitiesIn(uint32_t aRoom) const;
+    EntityId findByName(uint32_t aRoom, const char *aName) const;
+    std::vector<ObjectValue> takeLoot(EntityId aEntity);
+
+private:
+    // Private Methods
+    void removeFromRoom(EntityId aEntity, uint32_t aRoom);
+
+private:
+    friend class SaveGame;
+
+    // Members
+    std::vector<uint32_t> mKinds;                                   ///< Row of each entity in the catalog of EnemyFactory.
+    std::vector<int> mNumbers;                                      ///< Number shown after the name of each entity.
+    std::vector<int> mHealth;                                       ///< Health of each entity.
+    std::vector<AttackStats> mAttackStats;                          ///< Attack stats of each entity.
+    std::vector<uint32_t> mPositions;                               ///< Room index of each entity.
+    std::vector<uint32_t> mLastSimulated;                           ///< Turn up to which each entity was simulated.
+    std::vector<uint32_t> mLootTables;                              ///< Loot table each entity still rolls its loot from, or LootTables::NoLoot.
+    std::vector<uint32_t> mLootSeeds;                               ///< Seed each entity rolls its loot with.
+    std::unordered_map<uint32_t, std::vector<EntityId>> mRoomIndex; ///< Entities per room, in order of arrival.
+};
+
+#endif // ENTITYSTORE_H
\ No newline at end of file
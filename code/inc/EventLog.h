@@ -0,0 +1,71 @@
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include "BinaryFormat.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @class EventLog
+ * @brief Process-wide log of the game events in a compact binary form.
+ *
+ * Every event is a few varints with a timestamp, collected in memory and written to the file in
+ * large blocks. Events are only recorded while a log is open, and only from the game thread.
+ * The format is described in BinaryFormat.h, the eventlog tool turns a log back into text or CSV.
+ */
+class EventLog
+{
+public:
+    /**
+     * @brief Number of buffered bytes at which the events are written to the file.
+     */
+    static constexpr size_t WriteSize = 64 * 1024;
+
+    // Constructors
+    static EventLog &getInstance();
+
+    // Delete copy constructor and assignment operator to prevent copies
+    EventLog(const EventLog &) = delete;
+    EventLog &operator=(const EventLog &) = delete;
+
+    // Destructor
+    ~EventLog();
+
+    // Methods
+    void open(const std::string &aPath);
+    void close();
+    void flush();
+    bool isOpen() const;
+    void logCommand(const std::string &aCommand);
+    void logMove(uint32_t aFrom, uint32_t aTo);
+    void logAttack(const char *aEnemy, int aDamage);
+    void logDamage(const char *aEnemy, int aDamage);
+    void logPickup(const char *aObject);
+    void logDeath(const char *aName);
+    void logScore(const char *aName, int aScore);
+
+private:
+    // Constructors
+    EventLog(); // Private constructor
+
+    // Private Methods
+    void beginEvent(BinaryFormat::EventType aType);
+    void endEvent();
+    void putUnsigned(uint64_t aValue);
+    void putSigned(int64_t aValue);
+    void putText(const char *aText, size_t aLength);
+
+private:
+    // Members
+    std::string mPath;                                ///< Path of the open log.
+    std::ofstream mFile;                              ///< The open log.
+    std::vector<char> mBuffer;                        ///< Events not written to the file yet.
+    std::chrono::steady_clock::time_point mLastEvent; ///< Time of the previous event, or of opening the log.
+};
+
+#endif // EVENTLOG_H
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef EVENTREADER_H
+#define EVENTREADER_H
+
+#include "BinaryFormat.h"
+#include "MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class EventReader
+ * @brief Reads the events of an event log written by EventLog, one at a time.
+ */
+class EventReader
+{
+public:
+    /**
+     * @brief Struct representing a decoded event.
+     */
+    struct Event
+    {
+        BinaryFormat::EventType mType;    ///< The kind of event.
+        uint64_t mTime;                   ///< Microseconds since the Unix epoch.
+        std::vector<std::string> mFields; ///< The fields of the event, numbers in decimal.
+    };
+
+    // Constructors
+    EventReader(const char *aPath);
+
+    // Destructor
+    virtual ~EventReader() = default;
+
+    // Methods
+    bool next(Event &aEvent);
+    uint64_t getStartTime() const;
+
+    static const char *getTypeName(BinaryFormat::EventType aType);
+
+private:
+    // Private Methods
+    uint64_t getUnsigned();
+    int64_t getSigned();
+    std::string getText();
+
+private:
+    // Members
+    MappedFile mFile; ///< The mapped event log.
+    size_t mOffset;   ///< Read position of the next event.
+    uint64_t mStart;  ///< Microseconds since the Unix epoch when the log was opened.
+    uint64_t mTime;   ///< Time of the previous event.
+};
+
+#endif // EVENTREADER_H
\ No newline at end of file
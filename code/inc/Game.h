@@ -4,6 +4,8 @@
 #include "Player.h"
 #include "Sean.h"
 #include "DungeonFacade.h"
+#include "SessionRecorder.h"
+#include "SessionReplay.h"
 
 #include <memory>
 
@@ -24,6 +26,8 @@ enum class PlayerAction
     Consumeer,
     Help,
     Godmode,
+    Opslaan,
+    Herstel,
     Quit,
     Invalid
 };
@@ -37,12 +41,11 @@ public:
     Game();
 
     // Destructor
-    /**
-     * @brief Destructor for Game.
-     */
-    virtual ~Game() = default;
+    virtual ~Game();
 
     // Methods
+    void recordSession(const std::string &aPath);
+    void replaySession(const std::string &aPath);
     void run();
 
 private:
@@ -59,6 +62,7 @@ private:
     void lookAction();
     void searchAction();
     void goAction(const std::string &aDirection);
+    void travelAction(const std::string &aLocation);
     void takeAction(const std::string &aObject);
     void dropAction(const std::string &aObject);
     void examineAction(const std::string &aObject);
@@ -68,6 +72,8 @@ private:
     void consumeAction(const std::string &aObject);
     void helpAction() const;
     void godmodeAction();
+    void saveAction(const std::string &aPath);
+    void restoreAction(const std::string &aPath);
 
     void endGame();
 
@@ -83,11 +89,31 @@ private:
      */
     std::unique_ptr<DungeonFacade> mDungeon;
 
+    /**
+     * @brief The recorder of the session, if it is recorded.
+     */
+    std::unique_ptr<SessionRecorder> mRecorder;
+
+    /**
+     * @brief The session that is replayed, if any.
+     */
+    std::unique_ptr<SessionReplay> mReplay;
+
     /**
      * @brief The starting weapon for the player.
      */
     inline static const std::string StartingWeapon{"dolk"};
 
+    /**
+     * @brief The maximum number of locations of a generated dungeon.
+     */
+    inline static const int MaxGeneratedLocations{1000000};
+
+    /**
+     * @brief The file used to save and restore a game when no file is given.
+     */
+    inline static const std::string DefaultSaveFile{"kerker.sav"};
+
     /**
      * @brief Flag indicating whether the game should quit.
      */
@@ -3,29 +3,26 @@
 
 #include "Sean.h"
 #include "IGameObject.h"
+#include "ObjectTemplates.h"
+#include "ObjectValue.h"
 
-/**
- * @brief Enum class representing the type of a game object.
- */
-enum class ObjectType
-{
-    Gold,                  ///< Represents gold.
-    Weapon,                ///< Represents a weapon.
-    Armor,                 ///< Represents armor.
-    Consumable_Health,     ///< Represents a health consumable.
-    Consumable_Experience, ///< Represents an experience consumable.
-    Consumable_Teleport    ///< Represents a teleport consumable.
-};
+#include <cstddef>
+#include <cstdint>
 
 /**
  * @brief The GameObject class represents an object in the game.
+ *
+ * The name, description, type and value range are shared by all objects of the same kind and
+ * live in ObjectTemplates, an object only holds the index of its template and its own ID. The
+ * object classes are adapters over an ObjectValue, which implements their behaviour.
  */
 class GameObject : public IGameObject
 {
 public:
     // Constructors
     GameObject() = default;
-    GameObject(const Sean::String &aName, const Sean::String &aDescription, ObjectType aType, int aID);
+    GameObject(const Sean::String &aName, const Sean::String &aDescription, ObjectType aType, int aMinimum, int aMaximum, int aID);
+    GameObject(const ObjectValue &aValue);
     GameObject(const GameObject &other);
     GameObject(GameObject &&other) noexcept;
 
@@ -36,6 +33,10 @@ public:
     GameObject &operator=(const GameObject &other);
     GameObject &operator=(GameObject &&other) noexcept;
 
+    // Allocation
+    static void *operator new(std::size_t aSize);
+    static void operator delete(void *aObject, std::size_t aSize);
+
     // Methods
     virtual IGameObject *clone() const = 0;
     Sean::String getName() const override;
@@ -51,17 +52,19 @@ public:
     virtual int getMin() const override = 0;
     virtual int getMax() const override = 0;
     ObjectType getType() const;
+    uint32_t getTemplateId() const;
+    const ObjectTemplates::Template &getTemplate() const;
+    const ObjectValue &getObjectValue() const override;
 
 private:
     // Private Methods
     void swap(GameObject &other) noexcept;
 
 protected:
+    friend class SaveGame;
+
     // Members
-    Sean::String mName;        ///< Name of the object
-    int mID;                   ///< ID of the object
-    Sean::String mDescription; ///< Description of the object
-    ObjectType mType;          ///< Type of the object
+    ObjectValue mValue; ///< Type, template and ID of the object
 };
 
 #endif // GAMEOBJECT_H
\ No newline at end of file
@@ -2,8 +2,13 @@
 #define GAMEOBJECTFACTORY_H
 
 #include "GameObject.h"
+#include "NameIndex.h"
+#include "ObjectValue.h"
 #include "Sean.h"
 
+#include <cstdint>
+#include <vector>
+
 /**
  * @brief Factory class for creating GameObject objects.
  */
@@ -19,11 +24,30 @@ public:
     // Methods
     static GameObject *createGameObject(const Sean::String &aName);
     static GameObject *createGameObject();
+    static Sean::Vector<Sean::Object<GameObject>> createGameObjects(int aCount);
+    static Sean::Vector<Sean::Object<GameObject>> createGameObjects(const Sean::Vector<Sean::String> &aNames);
+    static std::vector<ObjectValue> createObjectValues(const Sean::Vector<Sean::String> &aNames);
 
     static void resetCounter();
+    static void raiseCounter(int aMinimum);
 
 private:
+    /**
+     * @brief Struct holding all rows of the Objecten table, resolved to the type and template of each row.
+     */
+    struct Catalog
+    {
+        Sean::Vector<Sean::String> mNames; ///< Names of the objects.
+        Sean::Vector<uint32_t> mTypes;     ///< Indexes of the types in ObjectTypeRegistry, or InvalidType.
+        Sean::Vector<uint32_t> mTemplates; ///< Indexes of the templates in ObjectTemplates.
+        NameIndex mRows;                   ///< Rows by name, the keys point into mNames.
+    };
+
     // Private Methods
+    static const Catalog &getCatalog();
+    static Catalog loadCatalog();
+    static GameObject *createFromCatalog(const Catalog &aCatalog, size_t aRow);
+    static GameObject *createFromRow(const Sean::String &aName, const Sean::String &aDescription, const Sean::String &aType, int aMinValue, int aMaxValue, int aProtection);
     static void incrementCounter();
 
 private:
@@ -11,6 +11,7 @@ class GoldObject : public GameObject
 public:
     // Constructors
     GoldObject(const Sean::String aName, const Sean::String aDescription, int aMinimumValue, int aMaximumValue, ObjectType aType, int aID);
+    GoldObject(const ObjectValue &aValue);
     GoldObject(const GoldObject &other);
     GoldObject(GoldObject &&other) noexcept;
 
@@ -27,15 +28,6 @@ public:
     int getValue() const override;
     int getMin() const override;
     int getMax() const override;
-
-private:
-    // Private Methods
-
-private:
-    // Members
-
-    int mMinimumValue; ///< The minimum value of the gold object.
-    int mMaximumValue; ///< The maximum value of the gold object.
 };
 
 #endif // GOLD_OBJECT_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define IGAMEOBJECT_H
 
 #include "Sean.h"
+#include "ObjectValue.h"
 
 /**
  * @brief interface for game objects
@@ -35,6 +36,7 @@ public:
     virtual int getValue() const = 0;
     virtual int getMin() const = 0;
     virtual int getMax() const = 0;
+    virtual const ObjectValue &getObjectValue() const = 0;
 };
 
 #endif // IGAMEOBJECT_H
\ No newline at end of file
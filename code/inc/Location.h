@@ -2,8 +2,9 @@
 #define LOCATION_H
 
 #include "Sean.h"
-#include "GameObject.h"
-#include "Enemy.h"
+#include "ObjectValue.h"
+
+#include <cstddef>
 
 /**
  * @brief Represents a location in the game.
@@ -24,27 +25,21 @@ public:
     Location(Location &&) noexcept = default;
     Location &operator=(Location &&) noexcept = default;
 
+    // Allocation
+    static void *operator new(std::size_t aSize);
+    static void operator delete(void *aObject, std::size_t aSize);
+
     // Methods
     Sean::String getName() const;
-    void addVisibleObject(GameObject *aObject);
-    void addHiddenObject(GameObject *aObject);
-    void addEnemy(Enemy aEnemy);
-    void removeEnemy(const char *aEnemyName);
-    void setExit(Sean::Direction aDirection, Location *aLocation);
-    Location *getExit(Sean::Direction aDirection) const;
-    Sean::Vector<Enemy> &getEnemies();
+    void addVisibleObject(const ObjectValue &aObject);
+    void addHiddenObject(const ObjectValue &aObject);
     void printDescriptionShort() const;
     void printDescriptionLong() const;
-    void printExits() const;
     void moveHiddenObjects();
-    GameObject *pickUpObject(const char *aObjectName);
+    bool pickUpObject(const char *aObjectName, ObjectValue &aObject);
     bool printObject(const char *aObjectName);
-    const Sean::Vector<Sean::Object<GameObject>> &getVisibleObjects() const;
-    const Sean::Vector<Sean::Object<GameObject>> &getHiddenObjects() const;
-    const Sean::Vector<Enemy> &getEnemies() const;
-
-private:
-    // Private Methods
+    const Sean::Vector<ObjectValue> &getVisibleObjects() const;
+    const Sean::Vector<ObjectValue> &getHiddenObjects() const;
 
 public:
     // Members
@@ -54,13 +49,8 @@ private:
     Sean::String mName;                                     ///< Name of the location
     int mID;                                                ///< ID of the location
     Sean::String mDescription;                              ///< Description of the location
-    Sean::Vector<Sean::Object<GameObject>> mVisibleObjects; ///< Objects that are visible in the location
-    Sean::Vector<Sean::Object<GameObject>> mHiddenObjects;  ///< Objects that are hidden in the location
-    Sean::Vector<Enemy> mEnemies;                           ///< Enemies in the location
-    Location *mNorth;                                       ///< Location to the north
-    Location *mEast;                                        ///< Location to the east
-    Location *mSouth;                                       ///< Location to the south
-    Location *mWest;                                        ///< Location to the west
+    Sean::Vector<ObjectValue> mVisibleObjects; ///< Objects that are visible in the location, back to back
+    Sean::Vector<ObjectValue> mHiddenObjects;  ///< Objects that are hidden in the location, back to back
 };
 
 #endif // LOCATION_H
\ No newline at end of file
@@ -6,6 +6,13 @@
 #include <sstream>
 #include <ctime>
 #include <iomanip>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace Sean
 {
@@ -13,6 +20,12 @@ namespace Sean
     /**
      * @class Logger
      * @brief A custom logger that redirects std::cout to both the console and a log file.
+     *
+     * Output is collected in a buffer and only handed on when std::cout is flushed, which the
+     * game does with every std::endl and before every read from std::cin. The console gets it
+     * directly, the log file through a lock-free ring buffer that a background thread writes out,
+     * so the game never waits for the disk. The log file is only guaranteed to be complete after
+     * flush, the explicit flush points of the game.
      */
     class Logger : public std::ostream
     {
@@ -21,43 +34,106 @@ namespace Sean
         ~Logger();
 
         static std::string getCurrentDateTime();
+        static std::string getLogFolder();
         static void createLogFile();
         static void replaceCoutCin();
+        static void flush();
         static std::streambuf *getOriginalCoutBuf();
         static std::streambuf *getOriginalCinBuf();
+        static void setConsoleOutput(bool aEnabled);
+        static bool hasConsoleOutput();
+        static void setInputBuf(std::streambuf *aInputBuf);
 
     private:
+        /**
+         * @class LogWriter
+         * @brief Writes the log file on a background thread.
+         *
+         * The game thread is the only producer and the writer thread the only consumer of the
+         * ring buffer, so both sides only publish their position with an atomic store. The writer
+         * thread sleeps between writes and is only woken when the ring fills up or on a flush.
+         */
+        class LogWriter
+        {
+        public:
+            /**
+             * @brief Size of the ring buffer in bytes, a power of two.
+             */
+            static constexpr size_t Capacity = 1 << 20;
+
+            /**
+             * @brief Longest time in milliseconds that written data waits in the ring buffer.
+             */
+            static constexpr int WriteInterval = 20;
+
+            LogWriter();
+            ~LogWriter();
+
+            void open(const std::string &aFileName);
+            void close();
+            void write(const char *aData, size_t aSize);
+            void flush();
+
+        private:
+            void run();
+
+            std::vector<char> mRing;                     ///< The ring buffer.
+            alignas(64) std::atomic<size_t> mHead;       ///< Number of bytes taken out of the ring by the writer thread.
+            alignas(64) std::atomic<size_t> mTail;       ///< Number of bytes put into the ring by the game thread.
+            alignas(64) std::atomic<uint64_t> mRequests; ///< Number of flushes requested.
+            std::atomic<bool> mStop;                     ///< Whether the writer thread should stop once the ring is empty.
+            uint64_t mFlushed;                           ///< Number of flushes done, guarded by mMutex.
+            std::mutex mMutex;                           ///< Guards mFlushed and the waits of both threads.
+            std::condition_variable mWake;               ///< Wakes the writer thread.
+            std::condition_variable mFlushDone;          ///< Signals a finished flush to the game thread.
+            std::ofstream mFile;                         ///< The log file, only used by the writer thread while it runs.
+            std::thread mThread;                         ///< The writer thread, only running while a log file is open.
+        };
+
         class LoggerBufCout : public std::streambuf
         {
         public:
-            LoggerBufCout(std::streambuf *aConsoleBufCout, std::ofstream &aFileStream);
+            /**
+             * @brief Size of the put area in bytes.
+             */
+            static constexpr size_t BufferSize = 4096;
+
+            LoggerBufCout(std::streambuf *aConsoleBufCout, LogWriter &aWriter);
+            void setConsoleBuf(std::streambuf *aConsoleBufCout);
+            std::streambuf *getConsoleBuf() const;
 
         protected:
             virtual int overflow(int c) override;
+            virtual std::streamsize xsputn(const char *s, std::streamsize n) override;
             virtual int sync() override;
 
         private:
-            std::streambuf *mConsoleBufCout; ///< The original console buffer for Cout.
-            std::ofstream &mFileStream;      ///< The log file stream.
+            bool drain();
+            bool write(const char *aData, size_t aSize);
+
+            std::streambuf *mConsoleBufCout; ///< The console buffer for Cout, nullptr to write to the log file only.
+            LogWriter &mWriter;              ///< The writer of the log file.
+            char mBuffer[BufferSize];        ///< The put area.
         };
 
         class LoggerBufCin : public std::streambuf
         {
         public:
-            LoggerBufCin(std::streambuf *aCinBuf, std::ofstream &aFileStream);
+            LoggerBufCin(std::streambuf *aCinBuf, LogWriter &aWriter);
+            void setCinBuf(std::streambuf *aCinBuf);
 
         protected:
             int uflow() override;
             int underflow() override;
 
         private:
-            std::streambuf *mCinBuf;
-            std::ofstream &mFileStream;
+            std::streambuf *mCinBuf; ///< The buffer the input is read from.
+            LogWriter &mWriter;      ///< The writer of the log file.
         };
 
+        LogWriter mWriter;                ///< The writer of the log file.
         LoggerBufCout mLoggerBufCout;     ///< The custom stream buffer for cout.
         LoggerBufCin mLoggerBufCin;       ///< The custom stream buffer for cin.
-        std::ofstream mLogFile;           ///< The log file stream.
         std::streambuf *mOriginalCoutBuf; ///< The original std::cout buffer.
         std::streambuf *mOriginalCinBuf;  ///< The original std::cin buffer.
 
@@ -0,0 +1,65 @@
+#ifndef LOOTTABLES_H
+#define LOOTTABLES_H
+
+#include "Sean.h"
+#include "ObjectValue.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class LootTables
+ * @brief Process-wide store of the loot that each kind of enemy drops.
+ *
+ * An enemy only keeps the index of its loot table and a seed. The objects are rolled from the
+ * table and the seed when the enemy is searched after its death, so spawning an enemy needs no
+ * objects and no query, and the same seed always gives the same loot.
+ */
+class LootTables
+{
+public:
+    /**
+     * @brief Index of the table of enemies that drop nothing.
+     */
+    static constexpr uint32_t NoLoot = 0;
+
+    /**
+     * @brief Struct representing the loot table of one kind of enemy.
+     */
+    struct Table
+    {
+        int mMinimum; ///< Minimum number of objects.
+        int mMaximum; ///< Maximum number of objects.
+    };
+
+    // Constructors
+    static LootTables &getInstance();
+
+    // Delete copy constructor and assignment operator to prevent copies
+    LootTables(const LootTables &) = delete;
+    LootTables &operator=(const LootTables &) = delete;
+
+    // Destructor
+    ~LootTables() = default;
+
+    // Methods
+    uint32_t find(const Sean::String &aEnemyName);
+    const Table &get(uint32_t aTable) const;
+    Sean::Vector<Sean::String> roll(uint32_t aTable, uint32_t aSeed);
+    std::vector<ObjectValue> createLoot(uint32_t aTable, uint32_t aSeed);
+
+private:
+    // Constructors
+    LootTables(); // Private constructor
+
+private:
+    // Members
+    std::deque<Table> mTables;                         ///< All tables, references to them stay valid.
+    std::unordered_map<std::string, uint32_t> mLookup; ///< Table indexes by enemy name, NoLoot for enemies without loot.
+    Sean::Vector<Sean::String> mObjectNames;           ///< Names of the objects loot is drawn from, read on the first roll.
+};
+
+#endif // LOOTTABLES_H
\ No newline at end of file
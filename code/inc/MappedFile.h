@@ -0,0 +1,31 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file, unmapped on destruction.
+ */
+class MappedFile
+{
+public:
+    // Constructors
+    MappedFile(const char *aPath);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    // Destructor
+    virtual ~MappedFile();
+
+    // Methods
+    const char *getData() const;
+    size_t getSize() const;
+
+private:
+    // Members
+    const char *mData; ///< Start of the mapping.
+    size_t mSize;      ///< Size of the mapping.
+};
+
+#endif // MAPPEDFILE_H
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef MOVEMENTSCHEDULER_H
+#define MOVEMENTSCHEDULER_H
+
+#include "EntityStore.h"
+#include "RoomGraph.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class MovementScheduler
+ * @brief Moves the enemies of a dungeon in two phases.
+ *
+ * All moves of a turn are first planned into a staging buffer from the current positions and
+ * then applied in one pass, so every enemy moves at most once per turn. Planning can be limited
+ * to the rooms around the player; enemies elsewhere are caught up once they come into range.
+ *
+ * Every enemy draws from its own random stream keyed by seed, entity ID and turn. Planning is
+ * split over worker threads by entity range and the per-thread results are merged in entity
+ * order, so the outcome does not depend on the number of threads.
+ */
+class MovementScheduler
+{
+public:
+    /**
+     * @brief Chance in percent that a living enemy moves in a turn.
+     */
+    static constexpr int MoveChance = 50;
+
+    /**
+     * @brief Maximum number of missed turns replayed when an enemy is caught up.
+     */
+    static constexpr uint32_t MaxCatchUpTurns = 16;
+
+    /**
+     * @brief Minimum number of enemies per worker thread, smaller turns are planned on the calling thread.
+     */
+    static constexpr size_t MinEntitiesPerThread = 4096;
+
+    /**
+     * @brief Struct representing a planned move.
+     */
+    struct Move
+    {
+        EntityStore::EntityId mEntity; ///< The entity to move.
+        uint32_t mRoom;                ///< The room index to move to.
+    };
+
+    // Constructors
+    MovementScheduler();
+
+    // Destructor
+    virtual ~MovementScheduler() = default;
+
+    // Methods
+    void setSeed(uint64_t aSeed);
+    uint64_t getSeed() const;
+    void setThreadCount(unsigned aThreads);
+    void planMoves(const EntityStore &aEntities, const RoomGraph &aGraph, uint32_t aTurn);
+    void planMoves(const EntityStore &aEntities, const RoomGraph &aGraph, const std::vector<uint32_t> &aRooms, uint32_t aTurn);
+    void applyMoves(EntityStore &aEntities, uint32_t aTurn);
+    void catchUp(EntityStore &aEntities, const RoomGraph &aGraph, const std::vector<uint32_t> &aRooms, uint32_t aTurn);
+    const std::vector<Move> &getPlannedMoves() const;
+
+private:
+    // Private Methods
+    void planSimulated(const EntityStore &aEntities, const RoomGraph &aGraph, uint32_t aTurn);
+    uint32_t chooseTarget(const EntityStore &aEntities, const RoomGraph &aGraph, EntityStore::EntityId aEntity, uint32_t aRoom, uint32_t aTurn) const;
+
+private:
+    // Members
+    std::vector<Move> mMoves;                      ///< Moves planned for the current turn, reused between turns.
+    std::vector<EntityStore::EntityId> mSimulated; ///< Entities simulated in the current turn, in entity order.
+    std::vector<std::vector<Move>> mThreadMoves;   ///< Moves planned by each worker thread.
+    uint64_t mSeed;                                ///< Seed of all random streams.
+    unsigned mThreadCount;                         ///< Maximum number of worker threads.
+};
+
+#endif // MOVEMENTSCHEDULER_H
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef NAMEINDEX_H
+#define NAMEINDEX_H
+
+#include "Sean.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @class NameIndex
+ * @brief Index from the names in a column to their rows, without copying the names.
+ *
+ * The keys point into the characters of the indexed names. Moving a Sean::Vector of strings
+ * keeps those characters in place, so the index stays valid when the column is moved along
+ * with it, but not when the column is copied or changed.
+ */
+class NameIndex
+{
+public:
+    /**
+     * @brief Marker for a name that is not in the column.
+     */
+    static constexpr size_t NoRow = SIZE_MAX;
+
+    // Constructors
+    NameIndex() = default;
+    explicit NameIndex(const Sean::Vector<Sean::String> &aNames);
+
+    // Methods
+    size_t find(std::string_view aName) const;
+    size_t find(const Sean::String &aName) const;
+    size_t find(const char *aName) const;
+
+private:
+    // Members
+    std::unordered_map<std::string_view, size_t> mRows; ///< Row of each name, the first row for a name that occurs twice.
+};
+
+#endif // NAMEINDEX_H
\ No newline at end of file
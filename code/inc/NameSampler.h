@@ -0,0 +1,47 @@
+#ifndef NAMESAMPLER_H
+#define NAMESAMPLER_H
+
+#include "RandomStream.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class NameSampler
+ * @brief Draws names from a catalog without replacement.
+ *
+ * The catalog is shuffled once. Draws walk through the shuffled order, and once every name
+ * has been used the order is walked again with a variant number, so the n-th draw is found
+ * in constant time and every draw is unique no matter how small the catalog is.
+ */
+class NameSampler
+{
+public:
+    /**
+     * @brief Struct representing a single draw.
+     */
+    struct Draw
+    {
+        size_t mIndex;     ///< Index of the name in the catalog.
+        uint32_t mVariant; ///< Variant of the name, 0 for the name itself.
+    };
+
+    // Constructors
+    NameSampler(size_t aCatalogSize, RandomStream aRandom);
+
+    // Destructor
+    virtual ~NameSampler() = default;
+
+    // Methods
+    Draw draw(size_t aNumber) const;
+    size_t getCatalogSize() const;
+
+    static std::string getVariantName(const char *aName, uint32_t aVariant);
+
+private:
+    // Members
+    std::vector<size_t> mOrder; ///< The catalog indexes in shuffled order.
+};
+
+#endif // NAMESAMPLER_H
\ No newline at end of file
@@ -0,0 +1,196 @@
+#ifndef OBJECTPOOL_H
+#define OBJECTPOOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * @class ObjectPool
+ * @brief Fixed-size block allocator for the instances of a class and its subclasses.
+ *
+ * Blocks are carved from large chunks and recycled through free lists, so creating and
+ * destroying many objects does not go through the general-purpose allocator. Every thread
+ * allocates from and frees to its own free list without locking; a thread only takes the lock
+ * to fetch a new chunk or, when it exits, to hand its free blocks back to the other threads.
+ * Chunks are never released, the memory is reused for the next objects instead.
+ *
+ * A class uses the pool by forwarding its operator new and operator delete to allocate and
+ * deallocate. Requests larger than a block, such as from a larger subclass, fall back to the
+ * global allocator.
+ *
+ * @tparam T The class whose instances are allocated.
+ */
+template <typename T>
+class ObjectPool
+{
+public:
+    /**
+     * @brief Size of a block, large enough for a T or a free list link.
+     */
+    static constexpr size_t BlockSize = ((sizeof(T) > sizeof(void *) ? sizeof(T) : sizeof(void *)) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    /**
+     * @brief Number of blocks in a chunk.
+     */
+    static constexpr size_t BlocksPerChunk = 1024;
+
+    /**
+     * @brief Allocates memory for an object.
+     *
+     * @param aSize The size of the object.
+     * @return void* The memory.
+     * @throws std::bad_alloc if no memory is available.
+     */
+    static void *allocate(size_t aSize)
+    {
+        if (aSize > BlockSize)
+        {
+            return ::operator new(aSize);
+        }
+        LocalCache &cache = getLocalCache();
+        if (cache.mFree == nullptr)
+        {
+            refill(cache);
+        }
+        FreeBlock *block = cache.mFree;
+        cache.mFree = block->mNext;
+        return block;
+    }
+
+    /**
+     * @brief Returns the memory of an object to the pool.
+     *
+     * @param aBlock The memory, may be nullptr.
+     * @param aSize The size of the object, as passed to allocate.
+     */
+    static void deallocate(void *aBlock, size_t aSize)
+    {
+        if (aBlock == nullptr)
+        {
+            return;
+        }
+        if (aSize > BlockSize)
+        {
+            ::operator delete(aBlock);
+            return;
+        }
+        LocalCache &cache = getLocalCache();
+        FreeBlock *block = static_cast<FreeBlock *>(aBlock);
+        block->mNext = cache.mFree;
+        cache.mFree = block;
+    }
+
+    /**
+     * @brief Gets the number of chunks allocated by all threads.
+     *
+     * @return size_t The number of chunks.
+     */
+    static size_t getChunkCount()
+    {
+        Shared &shared = getShared();
+        std::lock_guard<std::mutex> lock(shared.mMutex);
+        return shared.mChunks.size();
+    }
+
+private:
+    /**
+     * @brief Struct overlaying a free block with the link to the next free block.
+     */
+    struct FreeBlock
+    {
+        FreeBlock *mNext; ///< The next free block.
+    };
+
+    /**
+     * @brief Struct holding the state shared by all threads.
+     */
+    struct Shared
+    {
+        std::mutex mMutex;           ///< Guards the other members.
+        FreeBlock *mFree;            ///< Blocks handed back by threads that exited.
+        std::vector<char *> mChunks; ///< All chunks.
+    };
+
+    /**
+     * @brief Struct holding the free list of one thread.
+     */
+    struct LocalCache
+    {
+        FreeBlock *mFree; ///< The free blocks of the thread.
+
+        /**
+         * @brief Hands the free blocks back to the other threads when the thread exits.
+         */
+        ~LocalCache()
+        {
+            if (mFree == nullptr)
+            {
+                return;
+            }
+            FreeBlock *last = mFree;
+            while (last->mNext != nullptr)
+            {
+                last = last->mNext;
+            }
+            Shared &shared = getShared();
+            std::lock_guard<std::mutex> lock(shared.mMutex);
+            last->mNext = shared.mFree;
+            shared.mFree = mFree;
+        }
+    };
+
+    /**
+     * @brief Gets the state shared by all threads.
+     *
+     * It is never destroyed, so objects that are deleted during program exit can still be freed.
+     *
+     * @return Shared& The shared state.
+     */
+    static Shared &getShared()
+    {
+        static Shared *shared = new Shared{{}, nullptr, {}};
+        return *shared;
+    }
+
+    /**
+     * @brief Gets the free list of the calling thread.
+     *
+     * @return LocalCache& The free list.
+     */
+    static LocalCache &getLocalCache()
+    {
+        thread_local LocalCache cache{nullptr};
+        return cache;
+    }
+
+    /**
+     * @brief Fills an empty free list with the blocks handed back by exited threads, or with a new chunk.
+     *
+     * @param aCache The free list to fill.
+     * @throws std::bad_alloc if no memory is available.
+     */
+    static void refill(LocalCache &aCache)
+    {
+        Shared &shared = getShared();
+        std::lock_guard<std::mutex> lock(shared.mMutex);
+        if (shared.mFree != nullptr)
+        {
+            aCache.mFree = shared.mFree;
+            shared.mFree = nullptr;
+            return;
+        }
+
+        char *chunk = static_cast<char *>(::operator new(BlockSize * BlocksPerChunk));
+        shared.mChunks.push_back(chunk);
+        for (size_t i = BlocksPerChunk; i > 0; --i)
+        {
+            FreeBlock *block = reinterpret_cast<FreeBlock *>(chunk + (i - 1) * BlockSize);
+            block->mNext = aCache.mFree;
+            aCache.mFree = block;
+        }
+    }
+};
+
+#endif // OBJECTPOOL_H
\ No newline at end of file
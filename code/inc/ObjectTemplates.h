@@ -0,0 +1,77 @@
+#ifndef OBJECTTEMPLATES_H
+#define OBJECTTEMPLATES_H
+
+#include "Sean.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Enum class representing the type of a game object.
+ */
+enum class ObjectType : uint8_t
+{
+    Gold,                  ///< Represents gold.
+    Weapon,                ///< Represents a weapon.
+    Armor,                 ///< Represents armor.
+    Consumable_Health,     ///< Represents a health consumable.
+    Consumable_Experience, ///< Represents an experience consumable.
+    Consumable_Teleport    ///< Represents a teleport consumable.
+};
+
+/**
+ * @class ObjectTemplates
+ * @brief Process-wide store of the immutable part of game objects.
+ *
+ * The name, description, type and value range of an object are the same for every object of
+ * that kind, so they are stored once as a template. A game object only keeps the index of its
+ * template and its own ID, which makes objects small and cloning them a plain copy.
+ */
+class ObjectTemplates
+{
+public:
+    /**
+     * @brief Index of the empty template, used by objects that were moved from.
+     */
+    static constexpr uint32_t EmptyTemplate = 0;
+
+    /**
+     * @brief Struct representing a single template.
+     */
+    struct Template
+    {
+        Sean::String mName;        ///< Name of the object, without its ID.
+        Sean::String mDescription; ///< Description of the object.
+        ObjectType mType;          ///< Type of the object.
+        int mMinimum;              ///< Minimum value, damage or strength.
+        int mMaximum;              ///< Maximum value, damage or strength. Equal to mMinimum for armor.
+    };
+
+    // Constructors
+    static ObjectTemplates &getInstance();
+
+    // Delete copy constructor and assignment operator to prevent copies
+    ObjectTemplates(const ObjectTemplates &) = delete;
+    ObjectTemplates &operator=(const ObjectTemplates &) = delete;
+
+    // Destructor
+    ~ObjectTemplates() = default;
+
+    // Methods
+    uint32_t intern(const Sean::String &aName, const Sean::String &aDescription, ObjectType aType, int aMinimum, int aMaximum);
+    const Template &get(uint32_t aTemplate) const;
+    size_t getCount() const;
+
+private:
+    // Constructors
+    ObjectTemplates(); // Private constructor
+
+private:
+    // Members
+    std::deque<Template> mTemplates;                        ///< All templates, references to them stay valid.
+    std::unordered_multimap<std::string, uint32_t> mLookup; ///< Template indexes by name.
+};
+
+#endif // OBJECTTEMPLATES_H
\ No newline at end of file
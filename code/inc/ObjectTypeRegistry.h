@@ -0,0 +1,88 @@
+#ifndef OBJECTTYPEREGISTRY_H
+#define OBJECTTYPEREGISTRY_H
+
+#include "Sean.h"
+#include "GameObject.h"
+#include "ObjectTemplates.h"
+#include "ObjectValue.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ObjectTypeRegistry
+ * @brief Process-wide mapping from the rows of the Objecttypen table to the classes that implement them.
+ *
+ * The registry is filled once, when it is first used, so creating an object resolves its type
+ * with a single lookup and constructs it through the index of the type instead of comparing the
+ * type name against every known type. The built-in types are listed in a table in the source
+ * file, other types can be added with registerType.
+ */
+class ObjectTypeRegistry
+{
+public:
+    /**
+     * @brief Index returned for a type that is not registered.
+     */
+    static constexpr uint32_t InvalidType = UINT32_MAX;
+
+    /**
+     * @brief Function that creates the object for a value.
+     */
+    using Constructor = GameObject *(*)(const ObjectValue &aValue);
+
+    /**
+     * @brief Struct representing a single registered type.
+     */
+    struct Entry
+    {
+        Sean::String mName;       ///< Name of the type in the Objecttypen table.
+        ObjectType mType;         ///< Type of the objects.
+        Constructor mConstructor; ///< Creates the objects of the type.
+    };
+
+    // Constructors
+    static ObjectTypeRegistry &getInstance();
+
+    // Delete copy constructor and assignment operator to prevent copies
+    ObjectTypeRegistry(const ObjectTypeRegistry &) = delete;
+    ObjectTypeRegistry &operator=(const ObjectTypeRegistry &) = delete;
+
+    // Destructor
+    ~ObjectTypeRegistry() = default;
+
+    // Methods
+    uint32_t registerType(const Sean::String &aName, ObjectType aType, Constructor aConstructor);
+    uint32_t find(const Sean::String &aName) const;
+    const Entry &get(uint32_t aIndex) const;
+    size_t getCount() const;
+    uint32_t internTemplate(uint32_t aIndex, const Sean::String &aName, const Sean::String &aDescription, int aMinimum, int aMaximum, int aProtection) const;
+    GameObject *create(uint32_t aIndex, const Sean::String &aName, const Sean::String &aDescription, int aMinimum, int aMaximum, int aProtection, int aID) const;
+    GameObject *create(uint32_t aIndex, uint32_t aTemplate, int aID) const;
+
+    /**
+     * @brief Constructor for a registered type that is implemented by the class T.
+     *
+     * @tparam T The class of the objects, constructible from an ObjectValue.
+     * @param aValue The value of the object.
+     * @return GameObject* The new object, owned by the caller.
+     */
+    template <typename T>
+    static GameObject *construct(const ObjectValue &aValue)
+    {
+        return new T(aValue);
+    }
+
+private:
+    // Constructors
+    ObjectTypeRegistry(); // Private constructor
+
+private:
+    // Members
+    std::vector<Entry> mEntries;                        ///< All registered types.
+    std::unordered_map<std::string, uint32_t> mIndexes; ///< Type indexes by name.
+};
+
+#endif // OBJECTTYPEREGISTRY_H
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef OBJECTVALUE_H
+#define OBJECTVALUE_H
+
+#include "Sean.h"
+#include "ObjectTemplates.h"
+
+#include <cstdint>
+
+class GameObject;
+
+/**
+ * @class ObjectValue
+ * @brief A game object as a small value, tagged with its ObjectType.
+ *
+ * The value holds the type, the template and the ID of an object and implements its behaviour
+ * with a switch on the type instead of virtual calls. Values need no allocation and can be
+ * stored back to back, the GameObject classes wrap a value for code that works with pointers.
+ */
+class ObjectValue
+{
+public:
+    // Constructors
+    ObjectValue();
+    ObjectValue(uint32_t aTemplate, int aID);
+
+    // Destructor
+    ~ObjectValue() = default;
+
+    // Assignment Operators
+    ObjectValue(const ObjectValue &) = default;
+    ObjectValue &operator=(const ObjectValue &) = default;
+
+    // Methods
+    ObjectType getType() const;
+    bool isWeapon() const;
+    bool isArmor() const;
+    bool isConsumableHealth() const;
+    bool isConsumableExperience() const;
+    bool isConsumableTeleport() const;
+    bool isMoney() const;
+    uint32_t getTemplateId() const;
+    const ObjectTemplates::Template &getTemplate() const;
+    int getID() const;
+    Sean::String getName() const;
+    bool hasName(const char *aName) const;
+    void printName() const;
+    void printDescription() const;
+    int getValue() const;
+    int getMin() const;
+    int getMax() const;
+    GameObject *toObject() const;
+
+private:
+    // Members
+    ObjectType mType;   ///< Type of the object, copied from its template.
+    uint32_t mTemplate; ///< Index of the template of the object.
+    int32_t mID;        ///< ID of the object.
+};
+
+#endif // OBJECTVALUE_H
\ No newline at end of file
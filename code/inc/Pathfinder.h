@@ -0,0 +1,105 @@
+#ifndef PATHFINDER_H
+#define PATHFINDER_H
+
+#include "RoomGraph.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @class Pathfinder
+ * @brief Finds shortest routes over the exits of a dungeon.
+ *
+ * Routes are answered from distance fields: the number of steps from every room to the nearest
+ * of a set of target rooms, found by one breadth-first search over the arriving exits. Fields
+ * are cached, so once a field exists each step of a route is a lookup over at most four exits.
+ * When an exit changes, the cached fields are repaired instead of thrown away where possible.
+ *
+ * For random destinations at a given distance, the rooms around a start room are grouped in
+ * rings by their number of steps from it. Rings are built lazily up to the needed distance and
+ * cached, after which a destination is drawn with a single array access.
+ *
+ * Copies of a pathfinder share the distances of the cached fields until an exit change repairs
+ * them. The rings are cheap to rebuild and are not copied.
+ */
+class Pathfinder
+{
+public:
+    /**
+     * @brief Distance of a room from which no target can be reached.
+     */
+    static constexpr uint32_t Unreachable = 0xFFFFFFFF;
+
+    /**
+     * @brief Maximum number of distance fields kept in the cache.
+     */
+    static constexpr size_t MaxCachedFields = 8;
+
+    /**
+     * @brief Maximum number of start rooms whose rings are kept in the cache.
+     */
+    static constexpr size_t MaxCachedRings = 8;
+
+    // Constructors
+    Pathfinder();
+
+    // Destructor
+    virtual ~Pathfinder() = default;
+
+    // Assignment Operators
+    Pathfinder(const Pathfinder &aOther);
+    Pathfinder &operator=(const Pathfinder &aOther);
+
+    // Methods
+    const std::vector<uint32_t> &getDistanceField(const RoomGraph &aGraph, const std::vector<uint32_t> &aTargets);
+    uint32_t getDistance(const RoomGraph &aGraph, uint32_t aFrom, const std::vector<uint32_t> &aTargets);
+    uint32_t getNextStep(const RoomGraph &aGraph, uint32_t aFrom, const std::vector<uint32_t> &aTargets);
+    bool findPath(const RoomGraph &aGraph, uint32_t aFrom, const std::vector<uint32_t> &aTargets, std::vector<uint32_t> &aPath);
+    uint32_t getRoomAtDistance(const RoomGraph &aGraph, uint32_t aFrom, uint32_t aHops, uint64_t aRandom);
+    void exitAdded(const RoomGraph &aGraph, uint32_t aRoom, uint32_t aTarget);
+    void exitRemoved(const RoomGraph &aGraph, uint32_t aRoom, uint32_t aTarget);
+    void clear();
+    size_t getCachedFieldCount() const;
+    size_t getCachedRingsCount() const;
+
+private:
+    /**
+     * @brief Struct representing a cached distance field.
+     */
+    struct Field
+    {
+        std::vector<uint32_t> mTargets;                    ///< The target rooms, sorted.
+        std::shared_ptr<std::vector<uint32_t>> mDistances; ///< Steps from each room to the nearest target, shared with copies.
+        uint64_t mLastUsed;                                ///< Value of mUseCounter when the field was last used.
+    };
+
+    /**
+     * @brief Struct representing the rooms around a start room, grouped by distance.
+     */
+    struct Rings
+    {
+        uint32_t mFrom;                     ///< The start room.
+        uint32_t mHops;                     ///< Distance up to which the rings are built.
+        std::vector<uint32_t> mRooms;       ///< The rooms in order of distance.
+        std::vector<uint32_t> mRingOffsets; ///< Offset in mRooms of each ring, plus the total at the end.
+        uint64_t mLastUsed;                 ///< Value of mUseCounter when the rings were last used.
+    };
+
+    // Private Methods
+    Field &findField(const RoomGraph &aGraph, const std::vector<uint32_t> &aTargets);
+    Rings &findRings(const RoomGraph &aGraph, uint32_t aFrom, uint32_t aHops);
+    void buildRings(const RoomGraph &aGraph, Rings &aRings);
+    static void computeField(const RoomGraph &aGraph, Field &aField);
+    static uint32_t nextStep(const RoomGraph &aGraph, const Field &aField, uint32_t aFrom);
+
+private:
+    // Members
+    std::vector<Field> mFields;     ///< The cached fields.
+    std::vector<Rings> mRings;      ///< The cached rings.
+    std::vector<uint32_t> mVisited; ///< Per room, the visit mark of the last ring search that reached it.
+    uint32_t mVisitMark;            ///< Visit mark of the current ring search.
+    uint64_t mUseCounter;           ///< Counts cache lookups, used to evict the least recently used entry.
+};
+
+#endif // PATHFINDER_H
\ No newline at end of file
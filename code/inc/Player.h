@@ -1,11 +1,13 @@
 #ifndef PLAYER_H
 #define PLAYER_H
 
-#include "IGameObject.h"
+#include "ObjectValue.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
-#include <memory>
 
 /**
  * @brief player class
@@ -13,6 +15,11 @@
 class Player
 {
 public:
+    /**
+     * @brief Slot of an equip slot that holds no item.
+     */
+    static constexpr size_t NoSlot = SIZE_MAX;
+
     // Constructors
     Player();
     virtual ~Player() = default;
@@ -25,15 +32,17 @@ public:
 
     // Methods
     void printDescription() const;
-    std::unique_ptr<IGameObject> equipObject(const char *aItem);
-    void removeEquippedItem(IGameObject *equippedItem);
+    bool equipObject(const char *aItem, ObjectValue &aPreviousItem);
+    void removeEquippedItem(const ObjectValue *equippedItem);
     void addHealth(int aHealth);
     void addExperience(int aExperience);
-    void addObject(std::unique_ptr<IGameObject> aObject);
+    void addObject(const ObjectValue &aObject);
     bool printObject(const char *aObjectName) const;
-    std::unique_ptr<IGameObject> dropObject(const char *aObjectName);
+    bool dropObject(const char *aObjectName, ObjectValue &aObject);
+    bool removeObject(const ObjectValue *aObject);
+    const ObjectValue *findObject(const char *aObjectName) const;
     void toggleGodMode();
-    std::vector<std::unique_ptr<IGameObject>> &getInventory();
+    const std::vector<ObjectValue> &getInventory() const;
     int getHealth() const;
     int getAttackPercentage() const;
     int getAttackDamage() const;
@@ -42,18 +51,35 @@ public:
     std::string getName() const;
 
 private:
+    /**
+     * @brief Index from the hashes of the names of the items in the inventory to their slots.
+     *
+     * Keying on the hash lets a lookup by a C string hash it in place instead of building a
+     * std::string, items with colliding hashes are told apart with ObjectValue::hasName.
+     */
+    using InventoryIndex = std::unordered_multimap<size_t, size_t>;
+
     // Private Methods
+    size_t findSlot(const char *aObjectName) const;
+    void addToSlot(const ObjectValue &aObject);
+    ObjectValue removeSlot(size_t aSlot);
+    static size_t hashName(const char *aName, size_t aLength);
+    void indexInventory();
 
 private:
+    friend class SaveGame;
+
     // Members
-    std::string mName;                                    ///< The name of the player.
-    int mHealth;                                          ///< The health of the player.
-    int mAttackPercentage;                                ///< The attack percentage of the player.
-    std::vector<std::unique_ptr<IGameObject>> mInventory; ///< The inventory of the player.
-    int mGold;                                            ///< The amount of gold the player has.
-    IGameObject *mEquippedWeapon;                         ///< The equipped weapon of the player.
-    IGameObject *mEquippedArmor;                          ///< The equipped armor of the player.
-    bool mGodMode;                                        ///< Whether the player is in god mode.
+    std::string mName;                                           ///< The name of the player.
+    int mHealth;                                                 ///< The health of the player.
+    int mAttackPercentage;                                       ///< The attack percentage of the player.
+    std::vector<ObjectValue> mInventory;                         ///< The inventory of the player, including the equipped items, back to back.
+    InventoryIndex mInventoryIndex;                              ///< Slots of the inventory items by name hash.
+    std::vector<InventoryIndex::value_type *> mInventoryEntries; ///< Index entry of each slot, to move or remove it without a lookup.
+    int mGold;                                                   ///< The amount of gold the player has.
+    size_t mEquippedWeapon;                                      ///< The slot of the equipped weapon, or NoSlot.
+    size_t mEquippedArmor;                                       ///< The slot of the equipped armor, or NoSlot.
+    bool mGodMode;                                               ///< Whether the player is in god mode.
 };
 
 #endif // PLAYER_H
\ No newline at end of file
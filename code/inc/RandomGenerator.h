@@ -1,21 +1,41 @@
 #ifndef RANDOMGENERATOR_H
 #define RANDOMGENERATOR_H
 
-#include <random>
+#include <cstddef>
+#include <cstdint>
 
 /**
  * @brief class for generating random values and chances.
+ *
+ * Every thread draws from its own xoshiro256** engine, so generators can be created freely and
+ * used from any thread without locking. The engine of a thread is seeded from the system the
+ * first time it is used, unless it was seeded explicitly with seed.
  */
 class RandomGenerator
 {
 public:
     RandomGenerator() = default;
 
+    static void seed(uint64_t aSeed);
+    uint64_t next();
     int getRandomValue(int aMin, int aMax);
     bool getChance(int aPercent);
+    void fill(uint64_t *aValues, size_t aCount);
+    void fillRandomValues(int *aValues, size_t aCount, int aMin, int aMax);
 
 private:
-    static std::default_random_engine mEngine;
+    /**
+     * @brief Struct holding the state of the engine of one thread.
+     */
+    struct Engine
+    {
+        uint64_t mState[4]; ///< The xoshiro256** state, never all zero.
+    };
+
+    static Engine &getEngine();
+    static void seedEngine(Engine &aEngine, uint64_t aSeed);
+    static uint64_t nextValue(Engine &aEngine);
+    static uint64_t nextBelow(Engine &aEngine, uint64_t aRange);
 };
 
 #endif // RANDOMGENERATOR_H
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef RANDOMSTREAM_H
+#define RANDOMSTREAM_H
+
+#include <cstdint>
+
+/**
+ * @class RandomStream
+ * @brief A counter-based random stream.
+ *
+ * The values only depend on the seed, the stream and the counter it was created with, so
+ * independent streams can be drawn from any thread in any order and still give the same
+ * results every run.
+ */
+class RandomStream
+{
+public:
+    // Constructors
+    RandomStream(uint64_t aSeed, uint64_t aStream, uint64_t aCounter);
+
+    // Methods
+    uint64_t next();
+    int getRandomValue(int aMin, int aMax);
+    bool getChance(int aPercent);
+
+private:
+    // Members
+    uint64_t mState; ///< Current position in the stream.
+};
+
+#endif // RANDOMSTREAM_H
\ No newline at end of file
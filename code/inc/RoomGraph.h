@@ -0,0 +1,78 @@
+#ifndef ROOMGRAPH_H
+#define ROOMGRAPH_H
+
+#include "Sean.h"
+#include "DungeonLayout.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class RoomGraph
+ * @brief The exits between the rooms of a dungeon, stored as room indexes.
+ *
+ * Exits are kept in one contiguous array with ExitsPerRoom entries per room, so a direction
+ * lookup is a single array access. The exits that exist are also packed per room (compressed
+ * sparse rows) for graph walks that do not care about the direction, both leaving the room
+ * and, for walks towards a room, arriving in it.
+ *
+ * Changing an exit does not repack the rows. The rows of the rooms it touches are kept in a small
+ * overlay instead, which is packed into the rows once it holds a sixteenth of the rooms.
+ */
+class RoomGraph
+{
+public:
+    /**
+     * @brief Marker for a missing exit.
+     */
+    static constexpr uint32_t NoRoom = DungeonLayout::NoRoom;
+
+    /**
+     * @brief Number of exits stored per room.
+     */
+    static constexpr uint32_t ExitsPerRoom = DungeonLayout::ExitsPerRoom;
+
+    // Constructors
+    RoomGraph() = default;
+    RoomGraph(const DungeonLayout &aLayout);
+    RoomGraph(std::vector<uint32_t> aExits);
+
+    // Destructor
+    virtual ~RoomGraph() = default;
+
+    // Assignment Operators
+    RoomGraph(const RoomGraph &) = default;
+    RoomGraph &operator=(const RoomGraph &) = default;
+    RoomGraph(RoomGraph &&) noexcept = default;
+    RoomGraph &operator=(RoomGraph &&) noexcept = default;
+
+    // Methods
+    size_t getRoomCount() const;
+    uint32_t getExit(uint32_t aRoom, Sean::Direction aDirection) const;
+    const uint32_t *getNeighbours(uint32_t aRoom) const;
+    uint32_t getNeighbourCount(uint32_t aRoom) const;
+    const uint32_t *getPredecessors(uint32_t aRoom) const;
+    uint32_t getPredecessorCount(uint32_t aRoom) const;
+    void setExit(uint32_t aRoom, Sean::Direction aDirection, uint32_t aTarget);
+    void printExits(uint32_t aRoom) const;
+
+private:
+    // Private Methods
+    void buildAdjacency();
+    std::vector<uint32_t> &editPredecessors(uint32_t aRoom);
+
+private:
+    friend class SaveGame;
+
+    // Members
+    std::vector<uint32_t> mExits;                                             ///< Room index per direction, ExitsPerRoom per room.
+    std::vector<uint32_t> mNeighbourOffsets;                                  ///< Offset of the first neighbour of each room, plus the total at the end.
+    std::vector<uint32_t> mNeighbours;                                        ///< Existing exits of all rooms, in direction order.
+    std::vector<uint32_t> mPredecessorOffsets;                                ///< Offset of the first predecessor of each room, plus the total at the end.
+    std::vector<uint32_t> mPredecessors;                                      ///< Rooms with an exit to each room.
+    std::unordered_map<uint32_t, std::vector<uint32_t>> mChangedNeighbours;   ///< Neighbours of the rooms whose exits changed since the rows were packed.
+    std::unordered_map<uint32_t, std::vector<uint32_t>> mChangedPredecessors; ///< Predecessors of the rooms whose arriving exits changed since the rows were packed.
+};
+
+#endif // ROOMGRAPH_H
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef SAVEGAME_H
+#define SAVEGAME_H
+
+#include "Dungeon.h"
+#include "Player.h"
+#include "GameObject.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class SaveGame
+ * @brief A class to save the complete state of a game to a file and restore it.
+ *
+ * The whole snapshot is built in memory and written at once, and a saved game is read from a
+ * memory mapping, so checkpoints do not stall play. The format is described in BinaryFormat.h.
+ */
+class SaveGame
+{
+public:
+    // Constructors
+    SaveGame(const char *aPath);
+
+    // Destructor
+    virtual ~SaveGame() = default;
+
+    // Methods
+    void save(const Dungeon &aDungeon, const Player &aPlayer) const;
+    std::unique_ptr<Dungeon> load(Player &aPlayer) const;
+
+    static bool isSaveFile(const char *aPath);
+
+private:
+    // Private Methods
+    static void putObject(std::vector<char> &aBuffer, const ObjectValue &aObject);
+    static void putObjects(std::vector<char> &aBuffer, const ObjectValue *aObjects, uint32_t aCount);
+
+private:
+    // Members
+    std::string mPath; ///< Path of the saved game.
+};
+
+#endif // SAVEGAME_H
\ No newline at end of file
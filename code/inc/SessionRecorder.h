@@ -0,0 +1,65 @@
+#ifndef SESSIONRECORDER_H
+#define SESSIONRECORDER_H
+
+#include "BinaryFormat.h"
+
+#include <cstdint>
+#include <fstream>
+#include <streambuf>
+#include <string>
+
+/**
+ * @class SessionRecorder
+ * @brief Records a game session so it can be replayed with the same outcome.
+ *
+ * Every random value of a game is drawn from the RandomGenerator, so the seed it was given and
+ * the input that was read describe the whole session. The input is recorded as it is read
+ * through getInputBuf and written a line at a time. The format is described in BinaryFormat.h.
+ */
+class SessionRecorder
+{
+public:
+    // Constructors
+    SessionRecorder(const char *aPath, uint64_t aSeed, std::streambuf *aInputBuf);
+    SessionRecorder(const SessionRecorder &) = delete;
+    SessionRecorder &operator=(const SessionRecorder &) = delete;
+
+    // Destructor
+    virtual ~SessionRecorder();
+
+    // Methods
+    void recordSource(BinaryFormat::SessionSource aSource, const std::string &aText);
+    std::streambuf *getInputBuf();
+
+private:
+    /**
+     * @class RecordingBuf
+     * @brief Stream buffer that reads from another buffer and records every character it hands out.
+     */
+    class RecordingBuf : public std::streambuf
+    {
+    public:
+        RecordingBuf(SessionRecorder &aRecorder, std::streambuf *aInputBuf);
+
+    protected:
+        int uflow() override;
+        int underflow() override;
+
+    private:
+        SessionRecorder &mRecorder; ///< The recorder to record the input with.
+        std::streambuf *mInputBuf;  ///< The buffer the input is read from.
+    };
+
+    // Private Methods
+    void recordInput(char aCharacter);
+    void writeRecord(BinaryFormat::SessionRecord aRecord, const std::string &aData);
+
+private:
+    // Members
+    std::string mPath;         ///< Path of the recorded session.
+    std::ofstream mFile;       ///< The recorded session.
+    std::string mPendingInput; ///< Input of the current line, written once the line is complete.
+    RecordingBuf mInputBuf;    ///< Buffer the game reads its input from.
+};
+
+#endif // SESSIONRECORDER_H
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef SESSIONREPLAY_H
+#define SESSIONREPLAY_H
+
+#include "BinaryFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+/**
+ * @class SessionReplay
+ * @brief A recorded game session, read back to replay it.
+ *
+ * The game replays the session by seeding the RandomGenerator with getSeed and reading its
+ * input from getInputBuf instead of the console.
+ */
+class SessionReplay
+{
+public:
+    // Constructors
+    SessionReplay(const char *aPath);
+    SessionReplay(const SessionReplay &) = delete;
+    SessionReplay &operator=(const SessionReplay &) = delete;
+
+    // Destructor
+    virtual ~SessionReplay() = default;
+
+    // Methods
+    uint64_t getSeed() const;
+    BinaryFormat::SessionSource getSource() const;
+    const std::string &getSourceText() const;
+    size_t getInputCount() const;
+    std::streambuf *getInputBuf();
+
+private:
+    // Members
+    uint64_t mSeed;                      ///< Seed of the RandomGenerator.
+    BinaryFormat::SessionSource mSource; ///< Kind of dungeon the session was played in.
+    std::string mSourceText;             ///< Path of the loaded dungeon or number of generated locations.
+    size_t mInputCount;                  ///< Number of recorded input lines.
+    std::stringbuf mInputBuf;            ///< All recorded input.
+};
+
+#endif // SESSIONREPLAY_H
\ No newline at end of file
@@ -29,6 +29,12 @@ public:
     bool getObjectInfo(Sean::String &aName, Sean::String &aDescription, Sean::String &aType, int &aMinValue, int &aMaxValue, int &aProtection) const;
     bool getObjectAmount(Sean::String aName, int &aMinimum, int &aMaximum) const;
     bool getRandomObject(Sean::String &aName, Sean::String &aDescription, Sean::String &aType, int &aMinValue, int &aMaxValue, int &aProtection) const;
+    bool getAllLocations(Sean::Vector<Sean::String> &aNames, Sean::Vector<Sean::String> &aDescriptions) const;
+    bool getAllEnemyNames(Sean::Vector<Sean::String> &aNames) const;
+    bool getAllObjectNames(Sean::Vector<Sean::String> &aNames) const;
+    bool getAllObjectTypes(Sean::Vector<Sean::String> &aNames) const;
+    bool getAllEnemies(Sean::Vector<Sean::String> &aNames, Sean::Vector<Sean::String> &aDescriptions, Sean::Vector<int> &aHealths, Sean::Vector<int> &aAttackPercents, Sean::Vector<int> &aMinDamages, Sean::Vector<int> &aMaxDamages) const;
+    bool getAllObjects(Sean::Vector<Sean::String> &aNames, Sean::Vector<Sean::String> &aDescriptions, Sean::Vector<Sean::String> &aTypes, Sean::Vector<int> &aMinValues, Sean::Vector<int> &aMaxValues, Sean::Vector<int> &aProtections) const;
     void putHighscore(const Sean::String aName, int aScore) const;
     bool getHighscore(Sean::String &aName, int &aScore, int aRank) const;
 
@@ -11,6 +11,7 @@ class WeaponObject : public GameObject
 public:
     // Constructors
     WeaponObject(const Sean::String aName, const Sean::String aDescription, int aMinDamage, int aMaxDamage, ObjectType aType, int aID);
+    WeaponObject(const ObjectValue &aValue);
     WeaponObject(const WeaponObject &other);
     WeaponObject(WeaponObject &&other) noexcept;
 
@@ -28,15 +29,6 @@ public:
     int getValue() const override;
     int getMin() const override;
     int getMax() const override;
-
-private:
-    // Private Methods
-    void swap(WeaponObject &other) noexcept;
-
-private:
-    // Members
-    int mMinDamage; ///< The minimum damage of the weapon.
-    int mMaxDamage; ///< The maximum damage of the weapon.
 };
 
 #endif // WEAPONOBJECT_H
\ No newline at end of file
@@ -13,7 +13,17 @@
  * @param aID The ID of the object.
  */
 ArmorObject::ArmorObject(const Sean::String aName, const Sean::String aDescription, int aArmor, ObjectType aType, int aID)
-    : GameObject(aName, aDescription, aType, aID), mArmor(aArmor)
+    : GameObject(aName, aDescription, aType, aArmor, aArmor, aID)
+{
+}
+
+/**
+ * @brief Constructs an armor object that wraps an object value.
+ * 
+ * @param aValue The value of the object.
+ */
+ArmorObject::ArmorObject(const ObjectValue &aValue)
+    : GameObject(aValue)
 {
 }
 
@@ -22,7 +32,7 @@ ArmorObject::ArmorObject(const Sean::String aName, const Sean::String aDescripti
  * @param other The other ArmorObject to copy from.
  */
 ArmorObject::ArmorObject(const ArmorObject &other)
-    : GameObject(other), mArmor(other.mArmor)
+    : GameObject(other)
 {
 }
 
@@ -31,9 +41,8 @@ ArmorObject::ArmorObject(const ArmorObject &other)
  * @param other The other ArmorObject to move from.
  */
 ArmorObject::ArmorObject(ArmorObject &&other) noexcept
-    : GameObject(std::move(other)), mArmor(other.mArmor)
+    : GameObject(std::move(other))
 {
-    other.mArmor = 0;
 }
 
 // Assignment Operators
@@ -48,7 +57,6 @@ ArmorObject &ArmorObject::operator=(const ArmorObject &other)
     if (this != &other)
     {
         GameObject::operator=(other);
-        mArmor = other.mArmor;
     }
     return *this;
 }
@@ -63,8 +71,6 @@ ArmorObject &ArmorObject::operator=(ArmorObject &&other) noexcept
     if (this != &other)
     {
         GameObject::operator=(std::move(other));
-        mArmor = other.mArmor;
-        other.mArmor = 0;
     }
     return *this;
 }
@@ -85,8 +91,7 @@ IGameObject *ArmorObject::clone() const
  */
 void ArmorObject::printDescription() const
 {
-    std::cout << mDescription << std::endl;
-    std::cout << "Armor: " << mArmor << std::endl;
+    mValue.printDescription();
 }
 
 /**
@@ -95,7 +100,7 @@ void ArmorObject::printDescription() const
  */
 int ArmorObject::getArmor() const
 {
-    return mArmor;
+    return mValue.getMin();
 }
 
 /**
@@ -113,7 +118,7 @@ int ArmorObject::getValue() const
  */
 int ArmorObject::getMin() const
 {
-    return getArmor();
+    return mValue.getMin();
 }
 
 /**
@@ -122,16 +127,5 @@ int ArmorObject::getMin() const
  */
 int ArmorObject::getMax() const
 {
-    return getArmor();
-}
-
-// Private Methods
-
-/**
- * @brief Swaps the contents of this ArmorObject with another.
- * @param other The other ArmorObject to swap with.
- */
-void ArmorObject::swap(ArmorObject &other) noexcept
-{
-    std::swap(mArmor, other.mArmor);
+    return mValue.getMax();
 }
\ No newline at end of file
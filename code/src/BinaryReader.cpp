@@ -0,0 +1,99 @@
+#include "BinaryReader.h"
+#include "BinaryFormat.h"
+#include "MappedFile.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Copies an array out of the mapping and advances the read position.
+ *
+ * @param aTarget The vector to fill.
+ * @param aCount The number of elements to copy.
+ * @param aFile The mapped file.
+ * @param aOffset The read position, advanced past the array.
+ */
+template <typename T>
+static void readArray(std::vector<T> &aTarget, size_t aCount, const MappedFile &aFile, size_t &aOffset)
+{
+    aTarget.resize(aCount);
+    if (aCount > 0)
+    {
+        memcpy(aTarget.data(), aFile.getData() + aOffset, aCount * sizeof(T));
+    }
+    aOffset += aCount * sizeof(T);
+}
+
+/**
+ * @brief Constructs a BinaryReader object and reads the compiled dungeon.
+ *
+ * @param aPath The path to the compiled dungeon file.
+ * @throws std::runtime_error if the file cannot be read or is not a valid compiled dungeon.
+ */
+BinaryReader::BinaryReader(const char *aPath)
+{
+    MappedFile file(aPath);
+
+    BinaryFormat::Header header;
+    if (file.getSize() < sizeof(header))
+    {
+        throw std::runtime_error("Invalid dungeon file: too small");
+    }
+    memcpy(&header, file.getData(), sizeof(header));
+    if (memcmp(header.mMagic, BinaryFormat::Magic, sizeof(header.mMagic)) != 0)
+    {
+        throw std::runtime_error("Invalid dungeon file: wrong magic");
+    }
+    if (header.mVersion != BinaryFormat::Version)
+    {
+        throw std::runtime_error("Invalid dungeon file: unsupported version " + std::to_string(header.mVersion));
+    }
+
+    uint64_t expectedSize = sizeof(header) + uint64_t(header.mAtomCount) * sizeof(uint32_t) + header.mCharCount +
+                            uint64_t(header.mRoomCount) * (sizeof(DungeonLayout::Room) + DungeonLayout::ExitsPerRoom * sizeof(uint32_t)) +
+                            uint64_t(header.mListCount) * sizeof(uint32_t);
+    if (expectedSize != file.getSize())
+    {
+        throw std::runtime_error("Invalid dungeon file: size mismatch");
+    }
+
+    size_t offset = sizeof(header);
+    readArray(mLayout.mAtomOffsets, header.mAtomCount, file, offset);
+    readArray(mLayout.mAtomChars, header.mCharCount, file, offset);
+    readArray(mLayout.mRooms, header.mRoomCount, file, offset);
+    readArray(mLayout.mExits, size_t(header.mRoomCount) * DungeonLayout::ExitsPerRoom, file, offset);
+    readArray(mLayout.mLists, header.mListCount, file, offset);
+
+    // Validate every index once so the layout can be used without further checks
+    mLayout.checkIndexes("Invalid dungeon file");
+    mLayout.indexNames();
+}
+
+/**
+ * @brief Gets the layout read from the file.
+ *
+ * @return const DungeonLayout& A constant reference to the layout.
+ */
+const DungeonLayout &BinaryReader::getLayout() const
+{
+    return mLayout;
+}
+
+/**
+ * @brief Checks whether a file starts with the compiled dungeon magic.
+ *
+ * @param aPath The path to the file.
+ * @return bool True if the file is a compiled dungeon, false otherwise.
+ */
+bool BinaryReader::isBinaryFile(const char *aPath)
+{
+    std::ifstream file(aPath, std::ios_base::in | std::ios_base::binary);
+    char magic[sizeof(BinaryFormat::Magic)];
+    if (!file.read(magic, sizeof(magic)))
+    {
+        return false;
+    }
+    return memcmp(magic, BinaryFormat::Magic, sizeof(magic)) == 0;
+}
\ No newline at end of file
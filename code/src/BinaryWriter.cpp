@@ -0,0 +1,56 @@
+#include "BinaryWriter.h"
+#include "BinaryFormat.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+/**
+ * @brief Constructs a BinaryWriter for the given path.
+ *
+ * @param aPath The path of the file to write.
+ */
+BinaryWriter::BinaryWriter(const char *aPath)
+    : mPath(aPath)
+{
+}
+
+/**
+ * @brief Writes a layout to the file, replacing any existing content.
+ *
+ * @param aLayout The layout to write.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void BinaryWriter::write(const DungeonLayout &aLayout) const
+{
+    // Pad the character pool so the arrays after it stay aligned when mapped
+    size_t padding = (4 - aLayout.mAtomChars.size() % 4) % 4;
+
+    BinaryFormat::Header header;
+    memcpy(header.mMagic, BinaryFormat::Magic, sizeof(header.mMagic));
+    header.mVersion = BinaryFormat::Version;
+    header.mRoomCount = static_cast<uint32_t>(aLayout.mRooms.size());
+    header.mAtomCount = static_cast<uint32_t>(aLayout.mAtomOffsets.size());
+    header.mCharCount = static_cast<uint32_t>(aLayout.mAtomChars.size() + padding);
+    header.mListCount = static_cast<uint32_t>(aLayout.mLists.size());
+
+    std::ofstream file(mPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Failed to open file: " + mPath);
+    }
+
+    const char zeros[4] = {0, 0, 0, 0};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(aLayout.mAtomOffsets.data()), aLayout.mAtomOffsets.size() * sizeof(uint32_t));
+    file.write(aLayout.mAtomChars.data(), aLayout.mAtomChars.size());
+    file.write(zeros, padding);
+    file.write(reinterpret_cast<const char *>(aLayout.mRooms.data()), aLayout.mRooms.size() * sizeof(DungeonLayout::Room));
+    file.write(reinterpret_cast<const char *>(aLayout.mExits.data()), aLayout.mExits.size() * sizeof(uint32_t));
+    file.write(reinterpret_cast<const char *>(aLayout.mLists.data()), aLayout.mLists.size() * sizeof(uint32_t));
+
+    if (!file.good())
+    {
+        throw std::runtime_error("Failed to write file: " + mPath);
+    }
+}
\ No newline at end of file
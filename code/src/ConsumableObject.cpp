@@ -1,5 +1,4 @@
 #include "ConsumableObject.h"
-#include "RandomGenerator.h"
 #include <iostream>
 #include <utility>
 
@@ -16,7 +15,17 @@
  * @param aID The ID of the object.
  */
 ConsumableObject::ConsumableObject(const Sean::String aName, const Sean::String aDescription, int aMinimum, int aMaximum, ObjectType aType, int aID)
-    : GameObject(aName, aDescription, aType, aID), mMinimum(aMinimum), mMaximum(aMaximum)
+    : GameObject(aName, aDescription, aType, aMinimum, aMaximum, aID)
+{
+}
+
+/**
+ * @brief Constructs a consumable object that wraps an object value.
+ * 
+ * @param aValue The value of the object.
+ */
+ConsumableObject::ConsumableObject(const ObjectValue &aValue)
+    : GameObject(aValue)
 {
 }
 
@@ -26,7 +35,7 @@ ConsumableObject::ConsumableObject(const Sean::String aName, const Sean::String
  * @param other The other ConsumableObject to copy from.
  */
 ConsumableObject::ConsumableObject(const ConsumableObject &other)
-    : GameObject(other), mMinimum(other.mMinimum), mMaximum(other.mMaximum)
+    : GameObject(other)
 {
 }
 
@@ -36,10 +45,8 @@ ConsumableObject::ConsumableObject(const ConsumableObject &other)
  * @param other The other ConsumableObject to move from.
  */
 ConsumableObject::ConsumableObject(ConsumableObject &&other) noexcept
-    : GameObject(std::move(other)), mMinimum(other.mMinimum), mMaximum(other.mMaximum)
+    : GameObject(std::move(other))
 {
-    other.mMinimum = 0;
-    other.mMaximum = 0;
 }
 
 // Assignment Operators
@@ -55,8 +62,6 @@ ConsumableObject &ConsumableObject::operator=(const ConsumableObject &other)
     if (this != &other)
     {
         GameObject::operator=(other);
-        mMinimum = other.mMinimum;
-        mMaximum = other.mMaximum;
     }
     return *this;
 }
@@ -72,11 +77,6 @@ ConsumableObject &ConsumableObject::operator=(ConsumableObject &&other) noexcept
     if (this != &other)
     {
         GameObject::operator=(std::move(other));
-        mMinimum = other.mMinimum;
-        mMaximum = other.mMaximum;
-
-        other.mMinimum = 0;
-        other.mMaximum = 0;
     }
     return *this;
 }
@@ -98,8 +98,7 @@ IGameObject *ConsumableObject::clone() const
  */
 void ConsumableObject::printDescription() const
 {
-    std::cout << mDescription << std::endl;
-    std::cout << "Sterkte tussen: " << mMinimum << " - " << mMaximum << std::endl;
+    mValue.printDescription();
 }
 
 /**
@@ -109,8 +108,7 @@ void ConsumableObject::printDescription() const
  */
 int ConsumableObject::getValue() const
 {
-    RandomGenerator randomEngine;
-    return randomEngine.getRandomValue(mMinimum, mMaximum);
+    return mValue.getValue();
 }
 
 /**
@@ -120,7 +118,7 @@ int ConsumableObject::getValue() const
  */
 int ConsumableObject::getMin() const
 {
-    return mMinimum;
+    return mValue.getMin();
 }
 
 /**
@@ -130,18 +128,5 @@ int ConsumableObject::getMin() const
  */
 int ConsumableObject::getMax() const
 {
-    return mMaximum;
-}
-
-// Private Methods
-
-/**
- * @brief Swaps the contents of this object with another ConsumableObject.
- * 
- * @param other The other ConsumableObject to swap with.
- */
-void ConsumableObject::swap(ConsumableObject &other) noexcept
-{
-    std::swap(mMinimum, other.mMinimum);
-    std::swap(mMaximum, other.mMaximum);
+    return mValue.getMax();
 }
\ No newline at end of file
@@ -6,11 +6,27 @@
 #include "Enemy.h"
 #include "RandomGenerator.h"
 #include "Location.h"
+#include "DungeonGenerator.h"
+#include "EventLog.h"
 
 #include <stdexcept>
+#include <vector>
 
-// Dummy static Location for temporary initialization
-static Location dummyLocation("dummy", "dummy", 0);
+/**
+ * @brief Generates the layout of a random dungeon.
+ *
+ * @param aLocations The number of locations to generate.
+ * @return DungeonLayout The generated layout.
+ * @throws std::invalid_argument if the number of locations is not positive.
+ */
+static DungeonLayout generateLayout(int aLocations)
+{
+    if (aLocations <= 0)
+    {
+        throw std::invalid_argument("Number of locations must be greater than zero");
+    }
+    return DungeonGenerator(DungeonGenerator::Settings(static_cast<uint32_t>(aLocations))).generate();
+}
 
 /**
  * @brief Constructor that takes a vector of ParsedLocations.
@@ -18,122 +34,29 @@ static Location dummyLocation("dummy", "dummy", 0);
  * @param aLocations A vector of parsed locations to initialize the dungeon.
  */
 Dungeon::Dungeon(Sean::Vector<Sean::ParsedLocations> &aLocations)
-    : mCurrentLocation(&dummyLocation) // Temporary initialization
+    : Dungeon(DungeonLayout(aLocations))
 {
-    for (Sean::ParsedLocations &parsedLocation : aLocations)
-    {
-        try
-        {
-            // Create a new Location using the LocationFactory
-            Sean::Object<Location> location(LocationFactory::createLocation(parsedLocation.mName.get(), parsedLocation.mDescription.get(), parsedLocation.mId));
-            if (location.get() == nullptr)
-            {
-                throw std::runtime_error("Location not found");
-            }
-
-            // Add the new Location to mMap
-            mMap.push_back(std::move(*location));
-
-            // Add the enemies to the Location
-            for (Sean::String &enemy : parsedLocation.mEnemies)
-            {
-                try
-                {
-                    Sean::Object<Enemy> newEnemy(EnemyFactory::createEnemy(enemy.get()));
-                    if (newEnemy.get() == nullptr)
-                    {
-                        throw std::runtime_error("Enemy not found");
-                    }
-                    mMap.back().addEnemy(std::move(*newEnemy));
-                }
-                catch (const std::exception &e)
-                {
-                    throw;
-                }
-            }
-
-            // Add the objects to the Location
-            for (Sean::String &object : parsedLocation.mVisibleObjects)
-            {
-                try
-                {
-                    Sean::Object<GameObject> newObject(GameObjectFactory::createGameObject(object.get()));
-                    if (newObject.get() == nullptr)
-                    {
-                        throw std::runtime_error("Object not found");
-                    }
-                    mMap.back().addVisibleObject(newObject.release());
-                }
-                catch (const std::exception &e)
-                {
-                    throw;
-                }
-            }
-
-            for (Sean::String &object : parsedLocation.mHiddenObjects)
-            {
-                try
-                {
-                    Sean::Object<GameObject> newObject(GameObjectFactory::createGameObject(object.get()));
-                    if (newObject.get() == nullptr)
-                    {
-                        throw std::runtime_error("Object not found");
-                    }
-                    mMap.back().addHiddenObject(newObject.release());
-                }
-                catch (const std::exception &e)
-                {
-                    throw;
-                }
-            }
-        }
-        catch (const std::exception &e)
-        {
-            throw;
-        }
-    }
-
-    // Second pass: Set the exits for each location
-    for (Sean::ParsedLocations &parsedLocation : aLocations)
-    {
-        Location &currentLocation = mMap[parsedLocation.mId - 1];
-        for (Sean::DirectionInfo &direction : parsedLocation.mDirections)
-        {
-            if (direction.mID > aLocations.size())
-            {
-                throw std::runtime_error("Invalid location ID");
-            }
-            if (direction.mID == 0)
-            {
-                break;
-            }
-            switch (direction.mDirection)
-            {
-            case Sean::Direction::North:
-                currentLocation.setExit(Sean::Direction::North, &mMap[direction.mID - 1]);
-                break;
-            case Sean::Direction::East:
-                currentLocation.setExit(Sean::Direction::East, &mMap[direction.mID - 1]);
-                break;
-            case Sean::Direction::South:
-                currentLocation.setExit(Sean::Direction::South, &mMap[direction.mID - 1]);
-                break;
-            case Sean::Direction::West:
-                currentLocation.setExit(Sean::Direction::West, &mMap[direction.mID - 1]);
-                break;
-            }
-        }
-    }
+}
 
-    // Set mCurrentLocation to the first location in the map if available
-    if (!mMap.empty())
-    {
-        mCurrentLocation = &mMap[0];
-    }
-    else
+/**
+ * @brief Constructor that takes a compiled dungeon layout.
+ *
+ * Only the rooms around the start room are materialized, the rest stays in compact form. The exits
+ * move from the layout to the room graph, so the dungeon keeps a single copy of them.
+ *
+ * @param aLayout The layout to build the dungeon from, its first room is the start room.
+ */
+Dungeon::Dungeon(DungeonLayout aLayout)
+    : mMaterializeRadius(DefaultMaterializeRadius), mActiveSimulation(true), mTurn(0), mCurrentRoom(0), mCurrentLocation(nullptr), mEventLog(nullptr)
+{
+    mGraph = std::make_shared<RoomGraph>(aLayout.takeExits());
+    mLayout = std::make_shared<const DungeonLayout>(std::move(aLayout));
+    if (mLayout->getRoomCount() == 0)
     {
         throw std::runtime_error("No locations provided");
     }
+    mSpawnedRooms.assign(mLayout->getRoomCount(), false);
+    enterRoom(0);
 }
 
 /**
@@ -142,127 +65,38 @@ Dungeon::Dungeon(Sean::Vector<Sean::ParsedLocations> &aLocations)
  * @param aLocations The number of locations to generate in the dungeon.
  */
 Dungeon::Dungeon(int aLocations)
-    : mCurrentLocation(&dummyLocation) // Temporary initialization
+    : Dungeon(generateLayout(aLocations))
 {
-    if (aLocations <= 0)
-    {
-        throw std::invalid_argument("Number of locations must be greater than zero");
-    }
-
-    RandomGenerator randomGen;
-    Sean::Vector<Sean::String> usedNames;
-
-    // Generate unique locations
-    for (int i = 0; i < aLocations; ++i)
-    {
-        try
-        {
-            Sean::Object<Location> location;
-
-            // Ensure unique location name
-            do
-            {
-                location.reset(LocationFactory::createLocation());
-            } while (usedNames.contains(location.get()->getName()));
-
-            usedNames.push_back(location.get()->getName());
-            mMap.push_back(std::move(*location));
-
-            // Add visible objects
-            int numVisibleObjects = randomGen.getRandomValue(0, 3);
-            for (int j = 0; j < numVisibleObjects; ++j)
-            {
-                try
-                {
-                    Sean::Object<GameObject> object(GameObjectFactory::createGameObject());
-                    if (object.get())
-                    {
-                        mMap.back().addVisibleObject(object.release());
-                    }
-                }
-                catch (const std::exception &e)
-                {
-                    throw;
-                }
-            }
-
-            // Add hidden objects
-            int numHiddenObjects = randomGen.getRandomValue(0, 2);
-            for (int j = 0; j < numHiddenObjects; ++j)
-            {
-                try
-                {
-                    Sean::Object<GameObject> object(GameObjectFactory::createGameObject());
-                    if (object.get())
-                    {
-                        mMap.back().addHiddenObject(object.release());
-                    }
-                }
-                catch (const std::exception &e)
-                {
-                    throw;
-                }
-            }
-        }
-        catch (const std::exception &e)
-        {
-            throw;
-        }
-    }
-
-    // Ensure all locations are reachable by setting exits
-    for (int i = 0; i < aLocations; ++i)
-    {
-        Location &currentLocation = mMap[i];
-        int numExits = randomGen.getRandomValue(1, 4);
-        for (int j = 0; j < numExits; ++j)
-        {
-            int exitIndex = (i + j + 1) % aLocations;
-            currentLocation.setExit(static_cast<Sean::Direction>(j % 4), &mMap[exitIndex]);
-        }
-    }
-
-    // Add enemies to the dungeon
-    int numEnemies = (aLocations + 2) / 3; // One enemy per 3 locations, rounded up
-    for (int i = 0; i < numEnemies; ++i)
-    {
-        try
-        {
-            Sean::Object<Enemy> enemy(EnemyFactory::createEnemy());
-            if (enemy.get() != nullptr)
-            {
-                mMap[i % aLocations].addEnemy(*enemy);
-            }
-        }
-        catch (const std::exception &e)
-        {
-            throw;
-        }
-    }
+}
 
-    // Set mCurrentLocation to the first location in the map if available
-    if (!mMap.empty())
-    {
-        mCurrentLocation = &mMap[0];
-    }
-    else
-    {
-        throw std::runtime_error("No locations provided");
-    }
+/**
+ * @brief Constructs an empty dungeon, to be filled in by a saved game.
+ */
+Dungeon::Dungeon()
+    : mLayout(std::make_shared<const DungeonLayout>()), mGraph(std::make_shared<RoomGraph>()), mMaterializeRadius(DefaultMaterializeRadius), mActiveSimulation(true), mTurn(0), mCurrentRoom(0), mCurrentLocation(nullptr), mEventLog(nullptr)
+{
 }
 
 /**
- * @brief Copy constructor.
+ * @brief Copy constructor, the copy shares its rooms with the other dungeon.
+ *
+ * The layout is shared for good, it never changes. The exits, the materialized rooms and the
+ * cached routes are shared until one of the dungeons changes them, then that dungeon copies the
+ * part it changes. The copy keeps the
+ * seed of the other dungeon, so both simulate the same enemy moves. The copy records no events until
+ * it is given an event log.
  *
  * @param other The other Dungeon to copy from.
  */
 Dungeon::Dungeon(const Dungeon &other)
-    : mMap(other.mMap), mCurrentLocation(other.mCurrentLocation)
+    : mLayout(other.mLayout), mGraph(other.mGraph), mMap(other.mMap), mEntities(other.mEntities), mScheduler(other.mScheduler), mPathfinder(other.mPathfinder), mSpawnedRooms(other.mSpawnedRooms), mTouchedRooms(other.mTouchedRooms), mMaterializeRadius(other.mMaterializeRadius), mActiveRooms(other.mActiveRooms), mActiveSimulation(other.mActiveSimulation), mTurn(other.mTurn), mCurrentRoom(other.mCurrentRoom), mCurrentLocation(other.mCurrentLocation), mEventLog(nullptr)
 {
 }
 
 /**
- * @brief Copy assignment operator.
+ * @brief Copy assignment operator, the rooms are shared with the other dungeon.
+ *
+ * The event log is not copied, this dungeon keeps recording its events where it did before.
  *
  * @param other The other Dungeon to copy from.
  * @return Dungeon& A reference to this object.
@@ -271,12 +105,37 @@ Dungeon &Dungeon::operator=(const Dungeon &other)
 {
     if (this != &other)
     {
+        mLayout = other.mLayout;
+        mGraph = other.mGraph;
         mMap = other.mMap;
+        mEntities = other.mEntities;
+        mScheduler = other.mScheduler;
+        mPathfinder = other.mPathfinder;
+        mSpawnedRooms = other.mSpawnedRooms;
+        mTouchedRooms = other.mTouchedRooms;
+        mMaterializeRadius = other.mMaterializeRadius;
+        mActiveRooms = other.mActiveRooms;
+        mActiveSimulation = other.mActiveSimulation;
+        mTurn = other.mTurn;
+        mCurrentRoom = other.mCurrentRoom;
         mCurrentLocation = other.mCurrentLocation;
     }
     return *this;
 }
 
+/**
+ * @brief Creates a branch of the dungeon, for example to look ahead or to undo a move.
+ *
+ * Only the enemies are copied, every room is shared with this dungeon until one of the two
+ * changes it. Changes in the branch never show in this dungeon and the other way around.
+ *
+ * @return std::unique_ptr<Dungeon> The branch.
+ */
+std::unique_ptr<Dungeon> Dungeon::fork() const
+{
+    return std::unique_ptr<Dungeon>(new Dungeon(*this));
+}
+
 /**
  * @brief Updates the dungeon state.
  *
@@ -286,19 +145,23 @@ int Dungeon::update()
 {
     int damage = 0;
     bool enemiesAlive = false;
-    for (Enemy &enemy : mCurrentLocation->getEnemies())
+    for (EntityStore::EntityId enemy : mEntities.getEntitiesIn(mCurrentRoom))
     {
-        if (!enemy.isDead())
+        if (!mEntities.isDead(enemy))
         {
             enemiesAlive = true;
-            int attack = enemy.getAttack();
+            int attack = mEntities.getAttack(enemy);
+            if (mEventLog != nullptr)
+            {
+                mEventLog->logDamage(mEntities.getName(enemy).c_str(), attack);
+            }
             if (attack == 0)
             {
-                std::cout << "De " << enemy.getName() << " mist je" << std::endl;
+                std::cout << "De " << mEntities.getName(enemy) << " mist je" << std::endl;
             }
             else
             {
-                std::cout << "De " << enemy.getName() << " valt je aan met: " << attack << " schade" << std::endl;
+                std::cout << "De " << mEntities.getName(enemy) << " valt je aan met: " << attack << " schade" << std::endl;
             }
 
             damage += attack;
@@ -327,21 +190,22 @@ GameObject *Dungeon::createGameObject(const Sean::String &aName)
  * @brief Picks up an object from the current location.
  *
  * @param aObjectName The name of the object to pick up.
- * @return GameObject* A pointer to the picked-up object.
+ * @param aObject Set to the value of the picked-up object.
+ * @return bool True if the object was found, false otherwise.
  */
-GameObject *Dungeon::pickUpObject(const char *aObjectName)
+bool Dungeon::pickUpObject(const char *aObjectName, ObjectValue &aObject)
 {
-    return mCurrentLocation->pickUpObject(aObjectName);
+    return editCurrentLocation()->pickUpObject(aObjectName, aObject);
 }
 
 /**
  * @brief Places an object in the current location.
  *
- * @param aObject A pointer to the object to place.
+ * @param aObject The value of the object to place.
  */
-void Dungeon::placeObject(GameObject *aObject)
+void Dungeon::placeObject(const ObjectValue &aObject)
 {
-    mCurrentLocation->addVisibleObject(aObject);
+    editCurrentLocation()->addVisibleObject(aObject);
 }
 
 /**
@@ -358,7 +222,8 @@ void Dungeon::printShortDescription() const
 void Dungeon::printLongDescription() const
 {
     mCurrentLocation->printDescriptionLong();
-    mCurrentLocation->printExits();
+    printEnemies();
+    mGraph->printExits(mCurrentRoom);
 }
 
 /**
@@ -369,7 +234,7 @@ void Dungeon::printLongDescription() const
  */
 bool Dungeon::validLocation(Sean::Direction aDirection) const
 {
-    return mCurrentLocation->getExit(aDirection) != nullptr;
+    return mGraph->getExit(mCurrentRoom, aDirection) != RoomGraph::NoRoom;
 }
 
 /**
@@ -380,10 +245,14 @@ bool Dungeon::validLocation(Sean::Direction aDirection) const
  */
 bool Dungeon::moveLocation(Sean::Direction aDirection)
 {
-    Location *newLocation = mCurrentLocation->getExit(aDirection);
-    if (newLocation)
+    uint32_t newRoom = mGraph->getExit(mCurrentRoom, aDirection);
+    if (newRoom != RoomGraph::NoRoom)
     {
-        mCurrentLocation = newLocation;
+        if (mEventLog != nullptr)
+        {
+            mEventLog->logMove(mCurrentRoom, newRoom);
+        }
+        enterRoom(newRoom);
         return true;
     }
     std::cout << "Er is geen locatie in die richting" << std::endl;
@@ -395,92 +264,65 @@ bool Dungeon::moveLocation(Sean::Direction aDirection)
  */
 void Dungeon::moveHiddenObjects()
 {
-    mCurrentLocation->moveHiddenObjects();
+    editCurrentLocation()->moveHiddenObjects();
 }
 
 /**
- * @brief Prints information about an object in the current location.
+ * @brief Prints information about an object or enemy in the current location.
  *
- * @param aObjectName The name of the object to print.
+ * @param aObjectName The name of the object or enemy to print.
  * @return bool True if the object was found, false otherwise.
  */
 bool Dungeon::printObject(const char *aObjectName)
 {
-    return mCurrentLocation->printObject(aObjectName);
+    if (mCurrentLocation->printObject(aObjectName))
+    {
+        return true;
+    }
+
+    EntityStore::EntityId enemy = mEntities.findByName(mCurrentRoom, aObjectName);
+    if (enemy == EntityStore::NoEntity)
+    {
+        return false;
+    }
+
+    mEntities.printName(enemy);
+    mEntities.printDescription(enemy);
+    if (mEntities.isDead(enemy))
+    {
+        // Searching a dead enemy drops its loot in the room
+        Location *location = editCurrentLocation();
+        for (const ObjectValue &object : mEntities.takeLoot(enemy))
+        {
+            location->addVisibleObject(object);
+        }
+    }
+    return true;
 }
 
 /**
- * @brief Teleports the player a certain number of locations.
+ * @brief Teleports the player to a random location a given number of steps away.
+ *
+ * The destination is drawn from the cached rings of rooms around the current room, so it is
+ * found in constant time once the rings exist and is always exactly aAmount steps away, or as far
+ * as possible when no room is that far.
  *
- * @param aAmount The number of locations to teleport.
+ * @param aAmount The number of steps to teleport.
  */
 void Dungeon::teleport(int aAmount)
 {
-    if (aAmount >= mMap.size())
-    {
-        aAmount = mMap.size() - 1;
-    }
     if (aAmount <= 0)
     {
         return;
     }
 
-    Sean::Direction nextDirection = Sean::Direction::Invalid;
-    Sean::Direction previousDirection = Sean::Direction::Invalid;
     RandomGenerator randomEngine;
-
-    while (aAmount > 0)
+    uint32_t room = mPathfinder.getRoomAtDistance(*mGraph, mCurrentRoom, static_cast<uint32_t>(aAmount), randomEngine.next());
+    if (mEventLog != nullptr)
     {
-        Location *nextLocation = nullptr;
-        Location *locationNorth = mCurrentLocation->getExit(Sean::Direction::North);
-        Location *locationEast = mCurrentLocation->getExit(Sean::Direction::East);
-        Location *locationSouth = mCurrentLocation->getExit(Sean::Direction::South);
-        Location *locationWest = mCurrentLocation->getExit(Sean::Direction::West);
-
-        int attempts = 0;
-        const int maxAttempts = 20; // Maximum number of attempts to find a new direction
-
-        do
-        {
-            nextDirection = static_cast<Sean::Direction>(randomEngine.getRandomValue(0, 3));
-            switch (nextDirection)
-            {
-            case Sean::Direction::North:
-                nextLocation = locationNorth;
-                nextDirection = Sean::Direction::North;
-                break;
-            case Sean::Direction::East:
-                nextLocation = locationEast;
-                nextDirection = Sean::Direction::East;
-                break;
-            case Sean::Direction::South:
-                nextLocation = locationSouth;
-                nextDirection = Sean::Direction::South;
-                break;
-            case Sean::Direction::West:
-                nextLocation = locationWest;
-                nextDirection = Sean::Direction::West;
-                break;
-            }
-            attempts++;
-            if (attempts >= maxAttempts)
-            {
-                // Break out of the loop if max attempts are reached
-                return;
-            }
-        } while (nextLocation == nullptr);
-
-        if (nextDirection == previousDirection)
-        {
-            continue;
-        }
-        else
-        {
-            mCurrentLocation = nextLocation;
-            previousDirection = nextDirection;
-            --aAmount;
-        }
+        mEventLog->logMove(mCurrentRoom, room);
     }
+    enterRoom(room);
 }
 
 /**
@@ -492,31 +334,39 @@ void Dungeon::teleport(int aAmount)
  */
 bool Dungeon::attackEnemy(const char *aEnemyName, int aDamage)
 {
-    for (Enemy &enemy : mCurrentLocation->getEnemies())
+    for (EntityStore::EntityId enemy : mEntities.getEntitiesIn(mCurrentRoom))
     {
-        if (enemy.getName() == aEnemyName)
+        if (mEntities.getName(enemy) == aEnemyName)
         {
-            if (!enemy.isDead())
+            if (!mEntities.isDead(enemy))
             {
-                enemy.takeDamage(aDamage);
-                if (enemy.isDead())
+                if (mEventLog != nullptr)
+                {
+                    mEventLog->logAttack(aEnemyName, aDamage);
+                }
+                mEntities.takeDamage(enemy, aDamage);
+                if (mEntities.isDead(enemy))
                 {
-                    Sean::String enemyName = enemy.getName();
+                    Sean::String enemyName = mEntities.getName(enemy);
                     if (enemyName.starts_with("dode "))
                     {
                         enemyName = enemyName.substr(5);
                     }
+                    if (mEventLog != nullptr)
+                    {
+                        mEventLog->logDeath(enemyName.c_str());
+                    }
                     std::cout << "Je hebt de " << enemyName << " " << aDamage << " schade toegediend en verslagen" << std::endl;
                 }
                 else
                 {
-                    std::cout << "Je hebt de " << enemy.getName() << " " << aDamage << " schade toegediend" << std::endl;
+                    std::cout << "Je hebt de " << mEntities.getName(enemy) << " " << aDamage << " schade toegediend" << std::endl;
                 }
                 return true;
             }
             else
             {
-                std::cout << "De " << enemy.getName() << " is al verslagen" << std::endl;
+                std::cout << "De " << mEntities.getName(enemy) << " is al verslagen" << std::endl;
             }
         }
     }
@@ -535,59 +385,368 @@ const Location &Dungeon::getCurrentLocation() const
 }
 
 /**
- * @brief Moves enemies in the dungeon.
+ * @brief Gets the room index of the current location.
+ *
+ * @return uint32_t The room index.
+ */
+uint32_t Dungeon::getCurrentRoom() const
+{
+    return mCurrentRoom;
+}
+
+/**
+ * @brief Gets the enemies of the dungeon.
+ *
+ * @return const EntityStore& A reference to the entity store.
+ */
+const EntityStore &Dungeon::getEntities() const
+{
+    return mEntities;
+}
+
+/**
+ * @brief Sets the number of hops around the player in which rooms are materialized.
+ *
+ * @param aHops The number of hops, negative values are treated as zero.
+ */
+void Dungeon::setMaterializeRadius(int aHops)
+{
+    mMaterializeRadius = aHops < 0 ? 0 : aHops;
+    updateRegion();
+}
+
+/**
+ * @brief Sets whether only the enemies around the player are simulated.
+ *
+ * @param aEnabled True to simulate the rooms within the materialize radius, false to simulate the whole dungeon.
+ */
+void Dungeon::setActiveSimulation(bool aEnabled)
+{
+    mActiveSimulation = aEnabled;
+    if (mActiveSimulation)
+    {
+        mScheduler.catchUp(mEntities, *mGraph, mActiveRooms, mTurn);
+    }
+}
+
+/**
+ * @brief Gets the number of enemy turns that have passed.
+ *
+ * @return uint32_t The current turn.
+ */
+uint32_t Dungeon::getTurn() const
+{
+    return mTurn;
+}
+
+/**
+ * @brief Finds the shortest route from the player to the nearest location with a given name.
+ *
+ * @param aLocationName The name of the location to travel to.
+ * @param aRoute Filled with the directions to take, empty if the player is already there.
+ * @return bool True if such a location exists and can be reached, false otherwise.
+ */
+bool Dungeon::findRoute(const char *aLocationName, std::vector<Sean::Direction> &aRoute)
+{
+    aRoute.clear();
+    std::vector<uint32_t> targets = mLayout->findRooms(aLocationName);
+    std::vector<uint32_t> path;
+    if (targets.empty() || !mPathfinder.findPath(*mGraph, mCurrentRoom, targets, path))
+    {
+        return false;
+    }
+
+    uint32_t room = mCurrentRoom;
+    for (uint32_t next : path)
+    {
+        for (uint32_t direction = 0; direction < RoomGraph::ExitsPerRoom; ++direction)
+        {
+            if (mGraph->getExit(room, static_cast<Sean::Direction>(direction)) == next)
+            {
+                aRoute.push_back(static_cast<Sean::Direction>(direction));
+                break;
+            }
+        }
+        room = next;
+    }
+    return true;
+}
+
+/**
+ * @brief Gets the number of steps between two rooms.
+ *
+ * @param aFrom The room index to start from.
+ * @param aTo The room index to reach.
+ * @return uint32_t The number of steps, or Pathfinder::Unreachable.
+ * @throws std::out_of_range if a room index is invalid.
+ */
+uint32_t Dungeon::getDistance(uint32_t aFrom, uint32_t aTo)
+{
+    return mPathfinder.getDistance(*mGraph, aFrom, {aTo});
+}
+
+/**
+ * @brief Gets the first room on a shortest route between two rooms, for example for an enemy chasing the player.
+ *
+ * @param aFrom The room index to start from.
+ * @param aTo The room index to reach.
+ * @return uint32_t The room index to move to, or RoomGraph::NoRoom if aFrom is aTo or aTo cannot be reached.
+ * @throws std::out_of_range if a room index is invalid.
+ */
+uint32_t Dungeon::getNextStep(uint32_t aFrom, uint32_t aTo)
+{
+    return mPathfinder.getNextStep(*mGraph, aFrom, {aTo});
+}
+
+/**
+ * @brief Sets or removes an exit, keeping the cached routes up to date.
+ *
+ * @param aRoom The room index of the exit.
+ * @param aDirection The direction of the exit.
+ * @param aTarget The room index the exit leads to, or RoomGraph::NoRoom to remove the exit.
+ * @throws std::out_of_range if a room index or the direction is invalid.
+ */
+void Dungeon::setExit(uint32_t aRoom, Sean::Direction aDirection, uint32_t aTarget)
+{
+    size_t roomCount = mGraph->getRoomCount();
+    if (aRoom >= roomCount || (aTarget != RoomGraph::NoRoom && aTarget >= roomCount) || aDirection == Sean::Direction::Invalid)
+    {
+        throw std::out_of_range("Invalid exit");
+    }
+
+    // The exits may still be shared with a fork, the layout holds none
+    if (mGraph.use_count() > 1)
+    {
+        mGraph = std::make_shared<RoomGraph>(*mGraph);
+    }
+    uint32_t previous = mGraph->getExit(aRoom, aDirection);
+    mGraph->setExit(aRoom, aDirection, aTarget);
+    if (previous != RoomGraph::NoRoom)
+    {
+        mPathfinder.exitRemoved(*mGraph, aRoom, previous);
+    }
+    if (aTarget != RoomGraph::NoRoom)
+    {
+        mPathfinder.exitAdded(*mGraph, aRoom, aTarget);
+    }
+    updateRegion();
+}
+
+/**
+ * @brief Sets the log the move, attack, damage and death events of this dungeon are recorded in.
+ *
+ * @param aEventLog The event log, or nullptr to record nothing.
+ */
+void Dungeon::setEventLog(EventLog *aEventLog)
+{
+    mEventLog = aEventLog;
+}
+
+/**
+ * @brief Gets the number of rooms that currently exist as a full Location.
+ *
+ * @return size_t The number of materialized rooms.
+ */
+size_t Dungeon::getMaterializedCount() const
+{
+    return mMap.size();
+}
+
+/**
+ * @brief Moves the living enemies of the dungeon one turn.
+ *
+ * With active simulation only the enemies around the player are moved.
  */
 void Dungeon::moveEnemies()
 {
-    Sean::Vector<Sean::String> movedEnemies;
-    RandomGenerator randomEngine;
-    for (Location &location : mMap)
-    {
-        Sean::Vector<Location *> exits;
-        Location *north = location.getExit(Sean::Direction::North);
-        Location *east = location.getExit(Sean::Direction::East);
-        Location *south = location.getExit(Sean::Direction::South);
-        Location *west = location.getExit(Sean::Direction::West);
-        if (north != nullptr)
+    ++mTurn;
+    if (mActiveSimulation)
+    {
+        mScheduler.planMoves(mEntities, *mGraph, mActiveRooms, mTurn);
+    }
+    else
+    {
+        mScheduler.planMoves(mEntities, *mGraph, mTurn);
+    }
+    mScheduler.applyMoves(mEntities, mTurn);
+}
+
+/**
+ * @brief Moves the player to a room and updates the materialized region around it.
+ *
+ * @param aRoom The room index to move to.
+ */
+void Dungeon::enterRoom(uint32_t aRoom)
+{
+    mCurrentRoom = aRoom;
+    mCurrentLocation = materialize(aRoom);
+    mTouchedRooms.insert(aRoom);
+    updateRegion();
+}
+
+/**
+ * @brief Builds the full Location of a room from its compact form, if not done yet.
+ *
+ * @param aRoom The room index to materialize.
+ * @return Location* The materialized location.
+ * @throws std::runtime_error if an enemy or object of the room is not found.
+ */
+Location *Dungeon::materialize(uint32_t aRoom)
+{
+    auto existing = mMap.find(aRoom);
+    if (existing != mMap.end())
+    {
+        return existing->second.get();
+    }
+
+    const DungeonLayout::Room &layoutRoom = mLayout->getRoom(aRoom);
+    std::shared_ptr<Location> location(LocationFactory::createLocation(mLayout->getAtom(layoutRoom.mName), mLayout->getAtom(layoutRoom.mDescription), layoutRoom.mId));
+    if (location.get() == nullptr)
+    {
+        throw std::runtime_error("Location not found");
+    }
+
+    // Enemies live in the entity store, they are only spawned the first time
+    if (!mSpawnedRooms[aRoom])
+    {
+        const uint32_t *enemyAtoms = mLayout->getEnemies(aRoom);
+        std::vector<const char *> enemyNames(layoutRoom.mEnemyCount);
+        for (uint32_t i = 0; i < layoutRoom.mEnemyCount; ++i)
         {
-            exits.push_back(north);
+            enemyNames[i] = mLayout->getAtom(enemyAtoms[i]);
         }
-        if (east != nullptr)
+        EntityStore::EntityId firstEnemy = static_cast<EntityStore::EntityId>(mEntities.getEntityCount());
+        if (!EnemyFactory::spawnEnemies(enemyNames.data(), enemyNames.size(), mEntities, aRoom))
         {
-            exits.push_back(east);
+            throw std::runtime_error("Enemy not found");
         }
-        if (south != nullptr)
+        for (EntityStore::EntityId enemy = firstEnemy; enemy < mEntities.getEntityCount(); ++enemy)
+        {
+            mEntities.setLastSimulated(enemy, mTurn);
+        }
+        mSpawnedRooms[aRoom] = true;
+    }
+
+    // Visible and hidden objects are created in one batch, visible objects first
+    const uint32_t *visibleObjects = mLayout->getVisibleObjects(aRoom);
+    const uint32_t *hiddenObjects = mLayout->getHiddenObjects(aRoom);
+    Sean::Vector<Sean::String> objectNames;
+    for (uint32_t i = 0; i < layoutRoom.mVisibleCount; ++i)
+    {
+        objectNames.push_back(mLayout->getAtom(visibleObjects[i]));
+    }
+    for (uint32_t i = 0; i < layoutRoom.mHiddenCount; ++i)
+    {
+        objectNames.push_back(mLayout->getAtom(hiddenObjects[i]));
+    }
+    std::vector<ObjectValue> objects = GameObjectFactory::createObjectValues(objectNames);
+    if (objects.size() != objectNames.size())
+    {
+        throw std::runtime_error("Object not found");
+    }
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (i < layoutRoom.mVisibleCount)
         {
-            exits.push_back(south);
+            location->addVisibleObject(objects[i]);
         }
-        if (west != nullptr)
+        else
         {
-            exits.push_back(west);
+            location->addHiddenObject(objects[i]);
         }
+    }
+
+    Location *result = location.get();
+    mMap.emplace(aRoom, std::move(location));
+    return result;
+}
 
-        Sean::Vector<Enemy> enemiesToMove;
+/**
+ * @brief Gets the current location to change it, copying it first if it is shared with a fork.
+ *
+ * @return Location* The current location, owned by this dungeon only.
+ */
+Location *Dungeon::editCurrentLocation()
+{
+    std::shared_ptr<Location> &location = mMap.at(mCurrentRoom);
+    if (location.use_count() > 1)
+    {
+        location = std::shared_ptr<Location>(new Location(*location));
+        mCurrentLocation = location.get();
+    }
+    return mCurrentLocation;
+}
 
-        for (auto it = location.getEnemies().begin(); it != location.getEnemies().end(); ++it)
+/**
+ * @brief Materializes every room within the radius around the player and evicts untouched rooms outside it.
+ *
+ * The rooms within the radius are also the active region in which enemies are simulated.
+ */
+void Dungeon::updateRegion()
+{
+    // Breadth-first search of at most mMaterializeRadius hops
+    std::unordered_set<uint32_t> region{mCurrentRoom};
+    std::vector<uint32_t> frontier{mCurrentRoom};
+    for (int hop = 0; hop < mMaterializeRadius && !frontier.empty(); ++hop)
+    {
+        std::vector<uint32_t> next;
+        for (uint32_t room : frontier)
         {
-            Enemy &enemy = *it;
-            Sean::String enemyName = enemy.getName();
-            if (movedEnemies.contains(enemyName) || enemy.isDead())
+            const uint32_t *neighbours = mGraph->getNeighbours(room);
+            uint32_t neighbourCount = mGraph->getNeighbourCount(room);
+            for (uint32_t i = 0; i < neighbourCount; ++i)
             {
-                continue;
-            }
-            movedEnemies.push_back(enemyName);
-            if (randomEngine.getChance(50) && !exits.empty())
-            {
-                enemiesToMove.push_back(enemy);
+                if (region.insert(neighbours[i]).second)
+                {
+                    next.push_back(neighbours[i]);
+                }
             }
         }
+        frontier.swap(next);
+    }
 
-        // Move the enemies after collecting them
-        for (Enemy &enemy : enemiesToMove)
+    mActiveRooms.assign(region.begin(), region.end());
+    for (uint32_t room : mActiveRooms)
+    {
+        materialize(room);
+    }
+
+    // Enemies that come into range are fast-forwarded over the turns they missed
+    if (mActiveSimulation)
+    {
+        mScheduler.catchUp(mEntities, *mGraph, mActiveRooms, mTurn);
+    }
+
+    // Untouched rooms can be rebuilt from the layout at any time
+    for (auto iter = mMap.begin(); iter != mMap.end();)
+    {
+        if (region.count(iter->first) == 0 && mTouchedRooms.count(iter->first) == 0)
+        {
+            iter = mMap.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+/**
+ * @brief Prints the enemies in the current location.
+ */
+void Dungeon::printEnemies() const
+{
+    const std::vector<EntityStore::EntityId> &enemies = mEntities.getEntitiesIn(mCurrentRoom);
+    std::cout << "Vijanden:" << std::endl;
+    if (enemies.empty())
+    {
+        std::cout << "\tgeen" << std::endl;
+    }
+    else
+    {
+        for (EntityStore::EntityId enemy : enemies)
         {
-            Location *newLocation = exits[randomEngine.getRandomValue(0, exits.size() - 1)];
-            newLocation->addEnemy(enemy);
-            location.removeEnemy(enemy.getName().c_str());
+            std::cout << "\t" << mEntities.getName(enemy) << std::endl;
         }
     }
 }
\ No newline at end of file
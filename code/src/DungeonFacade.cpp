@@ -1,4 +1,6 @@
 #include "DungeonFacade.h"
+#include "SaveGame.h"
+#include "EventLog.h"
 #include <stdexcept>
 
 /**
@@ -19,6 +21,33 @@ void DungeonFacade::createDungeon(std::vector<Sean::ParsedLocations> &aLocations
                 locations.push_back(parsedLocation);
             }
             mDungeon = std::make_unique<Dungeon>(locations);
+            mDungeon->setEventLog(&EventLog::getInstance());
+        }
+        catch (const std::invalid_argument &e)
+        {
+            throw std::runtime_error(e.what());
+        }
+    }
+    else
+    {
+        throw std::runtime_error("Dungeon already created");
+    }
+}
+
+/**
+ * @brief Creates a dungeon from a compiled dungeon layout.
+ *
+ * @param aLayout The layout to build the dungeon from.
+ * @throws std::runtime_error if the dungeon is already created.
+ */
+void DungeonFacade::createDungeon(const DungeonLayout &aLayout)
+{
+    if (mDungeon == nullptr)
+    {
+        try
+        {
+            mDungeon = std::make_unique<Dungeon>(aLayout);
+            mDungeon->setEventLog(&EventLog::getInstance());
         }
         catch (const std::invalid_argument &e)
         {
@@ -44,6 +73,7 @@ void DungeonFacade::generateDungeon(int aLocations)
         try
         {
             mDungeon = std::make_unique<Dungeon>(aLocations);
+            mDungeon->setEventLog(&EventLog::getInstance());
         }
         catch (const std::invalid_argument &e)
         {
@@ -84,30 +114,26 @@ void DungeonFacade::moveHiddenObjects()
  * @brief Picks up an object from the current location.
  *
  * @param aObjectName The name of the object to pick up.
- * @return IGameObject* A pointer to the picked-up object.
+ * @param aObject Set to the value of the picked-up object.
+ * @return bool True if the object was found, false otherwise.
  */
-IGameObject *DungeonFacade::pickUpObject(const char *aObjectName)
+bool DungeonFacade::pickUpObject(const char *aObjectName, ObjectValue &aObject)
 {
-    return mDungeon->pickUpObject(aObjectName);
+    return mDungeon->pickUpObject(aObjectName, aObject);
 }
 
 /**
  * @brief Places an object in the current location.
  *
- * @param aObject A unique pointer to the object to place.
+ * The room stores the value itself, so placing an object allocates nothing.
+ *
+ * @param aObject The value of the object to place.
  * @return bool True if the object was placed successfully, false otherwise.
- * @throws std::runtime_error if the object type is invalid.
  */
-bool DungeonFacade::placeObject(std::unique_ptr<IGameObject> aObject)
+bool DungeonFacade::placeObject(const ObjectValue &aObject)
 {
-    // Convert IGameObject to GameObject
-    Sean::Object<GameObject> gameObject(dynamic_cast<GameObject *>(aObject.release()));
-    if (gameObject.get() != nullptr)
-    {
-        mDungeon->placeObject(gameObject.release());
-        return true;
-    }
-    throw std::runtime_error("Invalid object type");
+    mDungeon->placeObject(aObject);
+    return true;
 }
 
 /**
@@ -196,4 +222,41 @@ int DungeonFacade::update()
 void DungeonFacade::teleport(int aAmount)
 {
     mDungeon->teleport(aAmount);
+}
+
+/**
+ * @brief Finds the shortest route from the player to a location.
+ *
+ * @param aLocationName The name of the location to travel to.
+ * @param aRoute Filled with the directions to take, empty if the player is already there.
+ * @return bool True if the location exists and can be reached, false otherwise.
+ */
+bool DungeonFacade::findRoute(const char *aLocationName, std::vector<Sean::Direction> &aRoute)
+{
+    return mDungeon->findRoute(aLocationName, aRoute);
+}
+
+/**
+ * @brief Saves the dungeon and the player to a file.
+ *
+ * @param aPath The path of the saved game.
+ * @param aPlayer The player to save.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void DungeonFacade::saveGame(const char *aPath, const Player &aPlayer) const
+{
+    SaveGame(aPath).save(*mDungeon, aPlayer);
+}
+
+/**
+ * @brief Replaces the dungeon and the player with a saved game.
+ *
+ * @param aPath The path of the saved game.
+ * @param aPlayer The player to restore.
+ * @throws std::runtime_error if the file cannot be read or is not a valid saved game.
+ */
+void DungeonFacade::loadGame(const char *aPath, Player &aPlayer)
+{
+    mDungeon = SaveGame(aPath).load(aPlayer);
+    mDungeon->setEventLog(&EventLog::getInstance());
 }
\ No newline at end of file
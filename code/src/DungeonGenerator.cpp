@@ -0,0 +1,369 @@
+#include "DungeonGenerator.h"
+#include "NameSampler.h"
+#include "RandomGenerator.h"
+#include "RandomStream.h"
+#include "SqlReader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief Counters of the random streams of each room, one per kind of decision.
+ */
+enum class StreamPhase : uint64_t
+{
+    Tree,     ///< Spanning tree direction.
+    Loops,    ///< Extra loop edges.
+    Counts,   ///< Number of enemies and objects.
+    Contents, ///< Which enemies and objects.
+    Names,    ///< Order of the location names, only drawn from the stream of the start room.
+};
+
+/**
+ * @brief Measures the duration of a phase and records it.
+ *
+ * @param aTimings The timings to add the phase to.
+ * @param aName The name of the phase.
+ * @param aPhase The phase to run.
+ */
+static void timePhase(std::vector<DungeonGenerator::PhaseTiming> &aTimings, const char *aName, const std::function<void()> &aPhase)
+{
+    auto start = std::chrono::steady_clock::now();
+    aPhase();
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    aTimings.push_back({aName, duration.count()});
+}
+
+/**
+ * @brief Constructs settings with default densities and a random seed.
+ *
+ * The seed is drawn from the RandomGenerator, so a seeded generator also fixes the dungeon.
+ *
+ * @param aRoomCount The number of rooms to generate.
+ */
+DungeonGenerator::Settings::Settings(uint32_t aRoomCount)
+    : mRoomCount(aRoomCount), mLoopPercent(15), mEnemyPercent(33), mVisibleObjectPercent(50), mHiddenObjectPercent(25),
+      mSeed(RandomGenerator().next()), mThreadCount(std::max(1u, std::thread::hardware_concurrency()))
+{
+}
+
+/**
+ * @brief Constructs a generator.
+ *
+ * @param aSettings The settings of the dungeon to generate.
+ * @throws std::invalid_argument if no rooms are requested.
+ */
+DungeonGenerator::DungeonGenerator(const Settings &aSettings)
+    : mSettings(aSettings), mWidth(0)
+{
+    if (mSettings.mRoomCount == 0)
+    {
+        throw std::invalid_argument("Number of locations must be greater than zero");
+    }
+    mWidth = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(mSettings.mRoomCount))));
+}
+
+/**
+ * @brief Generates a dungeon.
+ *
+ * @return DungeonLayout The generated dungeon, room 0 is the start room.
+ * @throws std::runtime_error if the database has no locations, enemies or objects.
+ */
+DungeonLayout DungeonGenerator::generate()
+{
+    DungeonLayout layout;
+    mTimings.clear();
+
+    timePhase(mTimings, "catalog", [&]()
+              { loadCatalog(layout); });
+    timePhase(mTimings, "exits", [&]()
+              { buildExits(layout); });
+    timePhase(mTimings, "rooms", [&]()
+              { populateRooms(layout); });
+    timePhase(mTimings, "names", [&]()
+              { nameRooms(layout); });
+    layout.indexNames();
+
+    return layout;
+}
+
+/**
+ * @brief Gets the duration of each phase of the last generation.
+ *
+ * @return const std::vector<PhaseTiming>& The timings, in phase order.
+ */
+const std::vector<DungeonGenerator::PhaseTiming> &DungeonGenerator::getTimings() const
+{
+    return mTimings;
+}
+
+// Private Methods
+
+/**
+ * @brief Reads the names from the database once and stores them as atoms of the layout.
+ *
+ * @param aLayout The layout to store the atoms in.
+ * @throws std::runtime_error if the database has no locations, enemies or objects.
+ */
+void DungeonGenerator::loadCatalog(DungeonLayout &aLayout)
+{
+    SQLReader &sqlReader = SQLReader::getInstance();
+    Sean::Vector<Sean::String> names;
+    Sean::Vector<Sean::String> descriptions;
+    Sean::Vector<Sean::String> enemies;
+    Sean::Vector<Sean::String> objects;
+    if (!sqlReader.getAllLocations(names, descriptions))
+    {
+        throw std::runtime_error("Location not found in database");
+    }
+    if (!sqlReader.getAllEnemyNames(enemies))
+    {
+        throw std::runtime_error("Enemy not found in database");
+    }
+    if (!sqlReader.getAllObjectNames(objects))
+    {
+        throw std::runtime_error("Object not found in database");
+    }
+
+    mLocationNames.clear();
+    mLocationDescriptions.clear();
+    mEnemyNames.clear();
+    mObjectNames.clear();
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        mLocationNames.push_back(aLayout.intern(names[i].c_str()));
+        mLocationDescriptions.push_back(aLayout.intern(descriptions[i].c_str()));
+    }
+    for (const Sean::String &enemy : enemies)
+    {
+        mEnemyNames.push_back(aLayout.intern(enemy.c_str()));
+    }
+    for (const Sean::String &object : objects)
+    {
+        mObjectNames.push_back(aLayout.intern(object.c_str()));
+    }
+}
+
+/**
+ * @brief Sets the exits of every room.
+ *
+ * Each room only reads its own decisions and those of its neighbours, so rooms are handled in parallel.
+ *
+ * @param aLayout The layout to set the exits of.
+ */
+void DungeonGenerator::buildExits(DungeonLayout &aLayout) const
+{
+    uint32_t roomCount = mSettings.mRoomCount;
+    aLayout.mExits.assign(static_cast<size_t>(roomCount) * DungeonLayout::ExitsPerRoom, DungeonLayout::NoRoom);
+
+    parallelFor(roomCount, [&](size_t aBegin, size_t aEnd)
+                {
+                    for (uint32_t room = static_cast<uint32_t>(aBegin); room < aEnd; ++room)
+                    {
+                        uint32_t *exits = aLayout.mExits.data() + static_cast<size_t>(room) * DungeonLayout::ExitsPerRoom;
+                        if (room >= mWidth && hasSouthEdge(room - mWidth))
+                        {
+                            exits[static_cast<uint32_t>(Sean::Direction::North)] = room - mWidth;
+                        }
+                        if (hasEastEdge(room))
+                        {
+                            exits[static_cast<uint32_t>(Sean::Direction::East)] = room + 1;
+                        }
+                        if (hasSouthEdge(room))
+                        {
+                            exits[static_cast<uint32_t>(Sean::Direction::South)] = room + mWidth;
+                        }
+                        if (room % mWidth > 0 && hasEastEdge(room - 1))
+                        {
+                            exits[static_cast<uint32_t>(Sean::Direction::West)] = room - 1;
+                        }
+                    }
+                });
+}
+
+/**
+ * @brief Picks the enemies and objects of every room.
+ *
+ * The number of list entries per room is drawn first so every room knows where its entries go,
+ * then the entries themselves are filled in, both in parallel.
+ *
+ * @param aLayout The layout to add the rooms to.
+ */
+void DungeonGenerator::populateRooms(DungeonLayout &aLayout) const
+{
+    uint32_t roomCount = mSettings.mRoomCount;
+    aLayout.mRooms.resize(roomCount);
+
+    parallelFor(roomCount, [&](size_t aBegin, size_t aEnd)
+                {
+                    for (uint32_t room = static_cast<uint32_t>(aBegin); room < aEnd; ++room)
+                    {
+                        RandomStream random(mSettings.mSeed, room, static_cast<uint64_t>(StreamPhase::Counts));
+                        DungeonLayout::Room &layoutRoom = aLayout.mRooms[room];
+                        layoutRoom.mId = static_cast<int32_t>(room + 1);
+                        layoutRoom.mEnemyCount = random.getChance(mSettings.mEnemyPercent) ? 1 : 0;
+                        layoutRoom.mVisibleCount = 0;
+                        layoutRoom.mHiddenCount = 0;
+                        for (uint32_t slot = 0; slot < MaxObjectsPerRoom; ++slot)
+                        {
+                            layoutRoom.mVisibleCount += random.getChance(mSettings.mVisibleObjectPercent) ? 1 : 0;
+                            layoutRoom.mHiddenCount += random.getChance(mSettings.mHiddenObjectPercent) ? 1 : 0;
+                        }
+                    }
+                });
+
+    uint32_t listSize = 0;
+    for (DungeonLayout::Room &layoutRoom : aLayout.mRooms)
+    {
+        layoutRoom.mListOffset = listSize;
+        listSize += layoutRoom.mEnemyCount + layoutRoom.mVisibleCount + layoutRoom.mHiddenCount;
+    }
+    aLayout.mLists.resize(listSize);
+
+    parallelFor(roomCount, [&](size_t aBegin, size_t aEnd)
+                {
+                    for (uint32_t room = static_cast<uint32_t>(aBegin); room < aEnd; ++room)
+                    {
+                        RandomStream random(mSettings.mSeed, room, static_cast<uint64_t>(StreamPhase::Contents));
+                        const DungeonLayout::Room &layoutRoom = aLayout.mRooms[room];
+                        uint32_t *list = aLayout.mLists.data() + layoutRoom.mListOffset;
+                        for (uint32_t i = 0; i < layoutRoom.mEnemyCount; ++i)
+                        {
+                            *list++ = mEnemyNames[random.getRandomValue(0, static_cast<int>(mEnemyNames.size()) - 1)];
+                        }
+                        for (uint32_t i = 0; i < layoutRoom.mVisibleCount + layoutRoom.mHiddenCount; ++i)
+                        {
+                            *list++ = mObjectNames[random.getRandomValue(0, static_cast<int>(mObjectNames.size()) - 1)];
+                        }
+                    }
+                });
+}
+
+/**
+ * @brief Gives every room a unique name.
+ *
+ * Names are drawn without replacement from the catalog. Once the catalog runs out, variants such
+ * as "Binnenplaats II" are used, so naming always ends after one pass over the rooms. Variant
+ * names are added as new atoms, so this runs on a single thread.
+ *
+ * @param aLayout The layout to name the rooms of.
+ */
+void DungeonGenerator::nameRooms(DungeonLayout &aLayout) const
+{
+    NameSampler sampler(mLocationNames.size(), RandomStream(mSettings.mSeed, 0, static_cast<uint64_t>(StreamPhase::Names)));
+    for (uint32_t room = 0; room < aLayout.mRooms.size(); ++room)
+    {
+        NameSampler::Draw draw = sampler.draw(room);
+        DungeonLayout::Room &layoutRoom = aLayout.mRooms[room];
+        layoutRoom.mDescription = mLocationDescriptions[draw.mIndex];
+        if (draw.mVariant == 0)
+        {
+            layoutRoom.mName = mLocationNames[draw.mIndex];
+        }
+        else
+        {
+            // Variants are unique, so they skip the atom lookup and are appended directly
+            std::string name = NameSampler::getVariantName(aLayout.getAtom(mLocationNames[draw.mIndex]), draw.mVariant);
+            layoutRoom.mName = static_cast<uint32_t>(aLayout.mAtomOffsets.size());
+            aLayout.mAtomOffsets.push_back(static_cast<uint32_t>(aLayout.mAtomChars.size()));
+            aLayout.mAtomChars.insert(aLayout.mAtomChars.end(), name.c_str(), name.c_str() + name.size() + 1);
+        }
+    }
+}
+
+/**
+ * @brief Runs a body over a range of indexes, split in one contiguous chunk per thread.
+ *
+ * @param aCount The number of indexes.
+ * @param aBody The body, called with the begin and end of a chunk.
+ */
+void DungeonGenerator::parallelFor(size_t aCount, const std::function<void(size_t, size_t)> &aBody) const
+{
+    const size_t minChunkSize = 16384; // Smaller chunks are not worth a thread
+    size_t threadCount = std::min<size_t>(mSettings.mThreadCount, aCount / minChunkSize);
+    if (threadCount <= 1)
+    {
+        aBody(0, aCount);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    size_t chunkSize = (aCount + threadCount - 1) / threadCount;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        workers.emplace_back(aBody, i * chunkSize, std::min(aCount, (i + 1) * chunkSize));
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Checks whether a room joins the spanning tree through its northern neighbour.
+ *
+ * Rooms in the first column always connect north and rooms in the first row always connect west,
+ * so every room has a path to the start room in the corner.
+ *
+ * @param aRoom The index of the room, must not be the start room.
+ * @return bool True if the room connects north, false if it connects west.
+ */
+bool DungeonGenerator::connectsNorth(uint32_t aRoom) const
+{
+    if (aRoom % mWidth == 0)
+    {
+        return true;
+    }
+    if (aRoom < mWidth)
+    {
+        return false;
+    }
+    return RandomStream(mSettings.mSeed, aRoom, static_cast<uint64_t>(StreamPhase::Tree)).getChance(50);
+}
+
+/**
+ * @brief Checks whether there is an exit between a room and its eastern neighbour.
+ *
+ * @param aRoom The index of the room.
+ * @return bool True if the rooms are connected.
+ */
+bool DungeonGenerator::hasEastEdge(uint32_t aRoom) const
+{
+    uint32_t east = aRoom + 1;
+    if (east % mWidth == 0 || east >= mSettings.mRoomCount)
+    {
+        return false;
+    }
+    if (!connectsNorth(east))
+    {
+        return true;
+    }
+    return RandomStream(mSettings.mSeed, aRoom, static_cast<uint64_t>(StreamPhase::Loops)).getChance(mSettings.mLoopPercent);
+}
+
+/**
+ * @brief Checks whether there is an exit between a room and its southern neighbour.
+ *
+ * @param aRoom The index of the room.
+ * @return bool True if the rooms are connected.
+ */
+bool DungeonGenerator::hasSouthEdge(uint32_t aRoom) const
+{
+    uint32_t south = aRoom + mWidth;
+    if (south >= mSettings.mRoomCount)
+    {
+        return false;
+    }
+    if (connectsNorth(south))
+    {
+        return true;
+    }
+    RandomStream random(mSettings.mSeed, aRoom, static_cast<uint64_t>(StreamPhase::Loops));
+    random.next(); // The first value decides the eastern loop
+    return random.getChance(mSettings.mLoopPercent);
+}
\ No newline at end of file
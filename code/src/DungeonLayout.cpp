@@ -0,0 +1,418 @@
+#include "DungeonLayout.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * @brief Constructs a layout from parsed locations.
+ *
+ * @param aLocations The parsed locations, the first one is the start room.
+ * @throws std::runtime_error if a location ID is used twice, an exit refers to an unknown location ID or a location cannot be reached.
+ */
+DungeonLayout::DungeonLayout(const std::vector<Sean::ParsedLocations> &aLocations)
+{
+    build(aLocations.data(), aLocations.size());
+}
+
+/**
+ * @brief Constructs a layout from parsed locations.
+ *
+ * @param aLocations The parsed locations, the first one is the start room.
+ * @throws std::runtime_error if a location ID is used twice, an exit refers to an unknown location ID or a location cannot be reached.
+ */
+DungeonLayout::DungeonLayout(const Sean::Vector<Sean::ParsedLocations> &aLocations)
+{
+    build(aLocations.begin(), aLocations.size());
+}
+
+/**
+ * @brief Stores a text once and returns its atom index.
+ *
+ * @param aText The text to store.
+ * @return uint32_t The atom index of the text.
+ */
+uint32_t DungeonLayout::intern(const char *aText)
+{
+    if (aText == nullptr)
+    {
+        aText = "";
+    }
+
+    auto iter = mAtomLookup.find(aText);
+    if (iter != mAtomLookup.end())
+    {
+        return iter->second;
+    }
+
+    uint32_t atom = static_cast<uint32_t>(mAtomOffsets.size());
+    mAtomOffsets.push_back(static_cast<uint32_t>(mAtomChars.size()));
+    mAtomChars.insert(mAtomChars.end(), aText, aText + strlen(aText) + 1);
+    mAtomLookup.emplace(aText, atom);
+    return atom;
+}
+
+/**
+ * @brief Adds a room without exits.
+ *
+ * @param aLocation The parsed location to add.
+ * @return uint32_t The index of the new room.
+ */
+uint32_t DungeonLayout::addRoom(const Sean::ParsedLocations &aLocation)
+{
+    uint32_t room = appendRoom(aLocation);
+
+    // The new room has the highest index, so it goes after the rooms with the same name
+    uint32_t name = mRooms[room].mName;
+    auto position = std::upper_bound(mRoomsByName.begin(), mRoomsByName.end(), name, [this](uint32_t aAtom, uint32_t aRoom)
+                                     { return aAtom < mRooms[aRoom].mName; });
+    mRoomsByName.insert(position, room);
+    return room;
+}
+
+/**
+ * @brief Sets the exit of a room in the given direction.
+ *
+ * @param aRoom The index of the room.
+ * @param aDirection The direction of the exit.
+ * @param aTarget The index of the room the exit leads to, or NoRoom.
+ * @throws std::out_of_range if a room index or the direction is invalid.
+ */
+void DungeonLayout::setExit(uint32_t aRoom, Sean::Direction aDirection, uint32_t aTarget)
+{
+    if (aRoom >= mRooms.size() || (aTarget != NoRoom && aTarget >= mRooms.size()) || aDirection == Sean::Direction::Invalid)
+    {
+        throw std::out_of_range("Invalid exit");
+    }
+    mExits[aRoom * ExitsPerRoom + static_cast<uint32_t>(aDirection)] = aTarget;
+}
+
+/**
+ * @brief Gets the number of rooms.
+ *
+ * @return size_t The number of rooms.
+ */
+size_t DungeonLayout::getRoomCount() const
+{
+    return mRooms.size();
+}
+
+/**
+ * @brief Gets the number of atoms.
+ *
+ * @return size_t The number of atoms.
+ */
+size_t DungeonLayout::getAtomCount() const
+{
+    return mAtomOffsets.size();
+}
+
+/**
+ * @brief Gets a room by index.
+ *
+ * @param aRoom The index of the room.
+ * @return const Room& The room.
+ */
+const DungeonLayout::Room &DungeonLayout::getRoom(uint32_t aRoom) const
+{
+    return mRooms[aRoom];
+}
+
+/**
+ * @brief Gets the text of an atom.
+ *
+ * @param aAtom The atom index.
+ * @return const char* The null-terminated text.
+ */
+const char *DungeonLayout::getAtom(uint32_t aAtom) const
+{
+    return mAtomChars.data() + mAtomOffsets[aAtom];
+}
+
+/**
+ * @brief Gets the exit of a room in the given direction.
+ *
+ * @param aRoom The index of the room.
+ * @param aDirection The direction of the exit.
+ * @return uint32_t The index of the room the exit leads to, or NoRoom.
+ */
+uint32_t DungeonLayout::getExit(uint32_t aRoom, Sean::Direction aDirection) const
+{
+    if (aDirection == Sean::Direction::Invalid)
+    {
+        return NoRoom;
+    }
+    return mExits[aRoom * ExitsPerRoom + static_cast<uint32_t>(aDirection)];
+}
+
+/**
+ * @brief Gets the enemy atoms of a room.
+ *
+ * @param aRoom The index of the room.
+ * @return const uint32_t* The first of Room::mEnemyCount atoms.
+ */
+const uint32_t *DungeonLayout::getEnemies(uint32_t aRoom) const
+{
+    return mLists.data() + mRooms[aRoom].mListOffset;
+}
+
+/**
+ * @brief Gets the visible object atoms of a room.
+ *
+ * @param aRoom The index of the room.
+ * @return const uint32_t* The first of Room::mVisibleCount atoms.
+ */
+const uint32_t *DungeonLayout::getVisibleObjects(uint32_t aRoom) const
+{
+    return getEnemies(aRoom) + mRooms[aRoom].mEnemyCount;
+}
+
+/**
+ * @brief Gets the hidden object atoms of a room.
+ *
+ * @param aRoom The index of the room.
+ * @return const uint32_t* The first of Room::mHiddenCount atoms.
+ */
+const uint32_t *DungeonLayout::getHiddenObjects(uint32_t aRoom) const
+{
+    return getVisibleObjects(aRoom) + mRooms[aRoom].mVisibleCount;
+}
+
+/**
+ * @brief Finds the rooms with a given name.
+ *
+ * The name is resolved to its atom once, the rooms with that atom are then found in the index of
+ * rooms by name without comparing any text. Both indexes are complete once the layout is built or
+ * loaded, so the search only reads the layout and forks on other threads can search it at the same time.
+ *
+ * @param aName The name of the location.
+ * @return std::vector<uint32_t> The indexes of the rooms with that name, in room order.
+ */
+std::vector<uint32_t> DungeonLayout::findRooms(const char *aName) const
+{
+    std::vector<uint32_t> rooms;
+    auto atom = mAtomLookup.find(aName);
+    if (atom == mAtomLookup.end())
+    {
+        return rooms;
+    }
+
+    auto iter = std::lower_bound(mRoomsByName.begin(), mRoomsByName.end(), atom->second, [this](uint32_t aRoom, uint32_t aAtom)
+                                 { return mRooms[aRoom].mName < aAtom; });
+    for (; iter != mRoomsByName.end() && mRooms[*iter].mName == atom->second; ++iter)
+    {
+        rooms.push_back(*iter);
+    }
+    return rooms;
+}
+
+/**
+ * @brief Moves the exits out of the layout, for a RoomGraph that owns them from then on.
+ *
+ * The layout has no exits afterwards, only the graph may be asked for them.
+ *
+ * @return std::vector<uint32_t> The exits, ExitsPerRoom per room.
+ */
+std::vector<uint32_t> DungeonLayout::takeExits()
+{
+    return std::move(mExits);
+}
+
+// Private Methods
+
+/**
+ * @brief Adds a room without exits, leaving the index of rooms by name to the caller.
+ *
+ * @param aLocation The parsed location to add.
+ * @return uint32_t The index of the new room.
+ */
+uint32_t DungeonLayout::appendRoom(const Sean::ParsedLocations &aLocation)
+{
+    Room room;
+    room.mId = aLocation.mId;
+    room.mName = intern(aLocation.mName.c_str());
+    room.mDescription = intern(aLocation.mDescription.c_str());
+    room.mListOffset = static_cast<uint32_t>(mLists.size());
+    room.mEnemyCount = static_cast<uint32_t>(aLocation.mEnemies.size());
+    room.mVisibleCount = static_cast<uint32_t>(aLocation.mVisibleObjects.size());
+    room.mHiddenCount = static_cast<uint32_t>(aLocation.mHiddenObjects.size());
+
+    for (const Sean::String &enemy : aLocation.mEnemies)
+    {
+        mLists.push_back(intern(enemy.c_str()));
+    }
+    for (const Sean::String &object : aLocation.mVisibleObjects)
+    {
+        mLists.push_back(intern(object.c_str()));
+    }
+    for (const Sean::String &object : aLocation.mHiddenObjects)
+    {
+        mLists.push_back(intern(object.c_str()));
+    }
+
+    mRooms.push_back(room);
+    mExits.insert(mExits.end(), ExitsPerRoom, NoRoom);
+    return static_cast<uint32_t>(mRooms.size() - 1);
+}
+
+/**
+ * @brief Builds the lookup of atoms by text and the index of rooms by name from scratch.
+ *
+ * Called once after the rooms were added in bulk, by building from parsed locations, generating or
+ * loading a layout. Rooms are sorted by the atom of their name and then by room index, so the rooms
+ * with the same name are next to each other in room order.
+ */
+void DungeonLayout::indexNames()
+{
+    mAtomLookup.clear();
+    mAtomLookup.reserve(mAtomOffsets.size());
+    for (uint32_t i = 0; i < mAtomOffsets.size(); ++i)
+    {
+        mAtomLookup.emplace(getAtom(i), i);
+    }
+
+    mRoomsByName.resize(mRooms.size());
+    for (uint32_t room = 0; room < mRooms.size(); ++room)
+    {
+        mRoomsByName[room] = room;
+    }
+    std::stable_sort(mRoomsByName.begin(), mRoomsByName.end(), [this](uint32_t aFirst, uint32_t aSecond)
+                     { return mRooms[aFirst].mName < mRooms[aSecond].mName; });
+}
+
+/**
+ * @brief Builds the layout from parsed locations, translating location IDs to room indexes.
+ *
+ * The exits are linked in breadth-first order from the start room, so the same pass finds the rooms
+ * that can be reached. The rooms it does not reach are linked afterwards. All locations are checked
+ * before failing, so a malformed map is reported in one go.
+ *
+ * @param aLocations The first parsed location.
+ * @param aCount The number of parsed locations.
+ * @throws std::runtime_error with a report of every duplicate location ID, every exit to an unknown location ID and every location that cannot be reached from the start location.
+ */
+void DungeonLayout::build(const Sean::ParsedLocations *aLocations, size_t aCount)
+{
+    mRooms.reserve(aCount);
+    mExits.reserve(aCount * ExitsPerRoom);
+
+    std::string report;
+
+    // Translate location IDs to room indexes once, IDs do not have to be dense or ordered
+    std::unordered_map<int, uint32_t> roomById;
+    roomById.reserve(aCount);
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        uint32_t room = appendRoom(aLocations[i]);
+        if (!roomById.emplace(aLocations[i].mId, room).second)
+        {
+            report += "Duplicate location ID " + std::to_string(aLocations[i].mId) + "\n";
+        }
+    }
+
+    // Every room is queued at most once, so linking is linear in the number of rooms
+    std::vector<bool> reached(aCount, false);
+    std::vector<uint32_t> queue;
+    queue.reserve(aCount);
+    if (aCount > 0)
+    {
+        queue.push_back(0);
+        reached[0] = true;
+    }
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        linkRoom(aLocations, queue[head], roomById, reached, queue, report);
+    }
+    for (uint32_t room = 0; room < aCount; ++room)
+    {
+        if (!reached[room])
+        {
+            report += "Location " + std::to_string(aLocations[room].mId) + " cannot be reached from the start location\n";
+            linkRoom(aLocations, room, roomById, reached, queue, report);
+        }
+    }
+
+    if (!report.empty())
+    {
+        throw std::runtime_error("Invalid location ID\n" + report);
+    }
+    indexNames();
+}
+
+/**
+ * @brief Sets the exits of a room from its parsed location and queues the rooms they reach first.
+ *
+ * @param aLocations The first parsed location.
+ * @param aRoom The index of the room to link.
+ * @param aRoomById Room index by location ID.
+ * @param aReached Per room, whether it was reached from the start room, updated for the rooms queued.
+ * @param aQueue The rooms to link next, the rooms reached through the exits are added.
+ * @param aReport The report the exits to unknown location IDs are added to.
+ */
+void DungeonLayout::linkRoom(const Sean::ParsedLocations *aLocations, uint32_t aRoom, const std::unordered_map<int, uint32_t> &aRoomById, std::vector<bool> &aReached, std::vector<uint32_t> &aQueue, std::string &aReport)
+{
+    for (const Sean::DirectionInfo &direction : aLocations[aRoom].mDirections)
+    {
+        if (direction.mID == 0)
+        {
+            continue;
+        }
+        auto target = aRoomById.find(direction.mID);
+        if (target == aRoomById.end())
+        {
+            aReport += "Location " + std::to_string(aLocations[aRoom].mId) + " has an exit to unknown location ID " + std::to_string(direction.mID) + "\n";
+            continue;
+        }
+        setExit(aRoom, direction.mDirection, target->second);
+        if (!aReached[target->second])
+        {
+            aReached[target->second] = true;
+            aQueue.push_back(target->second);
+        }
+    }
+}
+
+/**
+ * @brief Checks that every index in the layout refers to an existing atom, room or list entry.
+ *
+ * Used after the arrays were copied in bulk from a file.
+ *
+ * @param aContext Start of the error message, naming the kind of file.
+ * @throws std::runtime_error if an index is out of range or the last atom is not terminated.
+ */
+void DungeonLayout::checkIndexes(const std::string &aContext) const
+{
+    if (!mAtomOffsets.empty() && (mAtomChars.empty() || mAtomChars.back() != '\0'))
+    {
+        throw std::runtime_error(aContext + ": unterminated atom");
+    }
+    for (uint32_t atomOffset : mAtomOffsets)
+    {
+        if (atomOffset >= mAtomChars.size())
+        {
+            throw std::runtime_error(aContext + ": atom out of range");
+        }
+    }
+    for (const Room &room : mRooms)
+    {
+        uint64_t listEnd = uint64_t(room.mListOffset) + room.mEnemyCount + room.mVisibleCount + room.mHiddenCount;
+        if (room.mName >= mAtomOffsets.size() || room.mDescription >= mAtomOffsets.size() || listEnd > mLists.size())
+        {
+            throw std::runtime_error(aContext + ": room out of range");
+        }
+    }
+    for (uint32_t exit : mExits)
+    {
+        if (exit != NoRoom && exit >= mRooms.size())
+        {
+            throw std::runtime_error(aContext + ": exit out of range");
+        }
+    }
+    for (uint32_t atom : mLists)
+    {
+        if (atom >= mAtomOffsets.size())
+        {
+            throw std::runtime_error(aContext + ": list entry out of range");
+        }
+    }
+}
\ No newline at end of file
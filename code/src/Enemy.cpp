@@ -1,6 +1,6 @@
 #include "Enemy.h"
-#include "GameObjectFactory.h"
-#include "SqlReader.h"
+#include "ObjectPool.h"
+#include "LootTables.h"
 #include "RandomGenerator.h"
 #include <iostream>
 
@@ -9,6 +9,8 @@
 /**
  * @brief Constructs an Enemy with the specified attributes.
  * 
+ * Only the loot table and a seed are stored, the loot itself is rolled when the enemy is searched after its death.
+ * 
  * @param aName The name of the enemy.
  * @param aDescription The description of the enemy.
  * @param aHealth The health of the enemy.
@@ -20,7 +22,33 @@
 Enemy::Enemy(Sean::String aName, Sean::String aDescription, int aHealth, int aAttackPercent, int aMinimumDamage, int aMaximumDamage, int aID)
     : mName(std::move(aName)), mDescription(std::move(aDescription)), mHealth(aHealth), mAttackPercent(aAttackPercent), mMinimumDamage(aMinimumDamage), mMaximumDamage(aMaximumDamage), mID(aID)
 {
-    initializeHiddenObjects();
+    mLootTable = LootTables::getInstance().find(mName);
+    RandomGenerator randomEngine;
+    mLootSeed = static_cast<uint32_t>(randomEngine.next());
+}
+
+// Allocation
+
+/**
+ * @brief Allocates the memory for an enemy from the Enemy pool.
+ * 
+ * @param aSize The size of the object.
+ * @return void* The memory.
+ */
+void *Enemy::operator new(std::size_t aSize)
+{
+    return ObjectPool<Enemy>::allocate(aSize);
+}
+
+/**
+ * @brief Returns the memory of an enemy to the Enemy pool.
+ * 
+ * @param aObject The memory of the object.
+ * @param aSize The size of the object.
+ */
+void Enemy::operator delete(void *aObject, std::size_t aSize)
+{
+    ObjectPool<Enemy>::deallocate(aObject, aSize);
 }
 
 // Methods
@@ -112,48 +140,4 @@ int Enemy::getAttack() const
         return randomEngine.getRandomValue(mMinimumDamage, mMaximumDamage);
     }
     return 0;
-}
-
-// Private Methods
-
-/**
- * @brief Initializes the hidden objects of the enemy.
- * 
- * This method retrieves the amount of hidden objects from the database and creates them using the GameObjectFactory.
- */
-void Enemy::initializeHiddenObjects()
-{
-    int minAmount;
-    int maxAmount;
-    if (!SQLReader::getInstance().getObjectAmount(mName, minAmount, maxAmount))
-    {
-        return;
-    }
-
-    if (maxAmount <= 0)
-    {
-        return;
-    }
-
-    RandomGenerator randomEngine;
-    int amount = randomEngine.getRandomValue(minAmount, maxAmount);
-
-    for (int i = 0; i < amount; ++i)
-    {
-        Sean::String name;
-        Sean::String description;
-        Sean::String type;
-        int minValue;
-        int maxValue;
-        int protection;
-
-        if (SQLReader::getInstance().getRandomObject(name, description, type, minValue, maxValue, protection))
-        {
-            Sean::Object<GameObject> object(GameObjectFactory::createGameObject(name));
-            if (object.get() != nullptr)
-            {
-                mHiddenObjects.push_back(std::move(object));
-            }
-        }
-    }
 }
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include "EnemyFactory.h"
+#include "EntityStore.h"
+#include "LootTables.h"
+#include "RandomGenerator.h"
 #include "SqlReader.h"
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 int EnemyFactory::mCounter = 0;
 
@@ -64,11 +69,207 @@ Enemy *EnemyFactory::createEnemy()
     return nullptr;
 }
 
+/**
+ * @brief Creates a number of random enemies from the catalog of the Vijanden table.
+ *
+ * The enemies are allocated one after the other from the Enemy pool, so a batch is laid out close
+ * together in memory.
+ *
+ * @param aCount The number of enemies to create.
+ * @return Sean::Vector<Sean::Object<Enemy>> The created enemies, empty if the database has no enemies.
+ */
+Sean::Vector<Sean::Object<Enemy>> EnemyFactory::createEnemies(int aCount)
+{
+    Sean::Vector<Sean::Object<Enemy>> enemies;
+    if (aCount <= 0)
+    {
+        return enemies;
+    }
+
+    const Catalog &catalog = getCatalog();
+    if (catalog.mNames.empty())
+    {
+        std::cerr << "Enemy not found in database" << std::endl;
+        return enemies;
+    }
+
+    std::vector<int> rows(static_cast<size_t>(aCount));
+    RandomGenerator randomEngine;
+    randomEngine.fillRandomValues(rows.data(), rows.size(), 0, static_cast<int>(catalog.mNames.size()) - 1);
+    for (int row : rows)
+    {
+        enemies.push_back(Sean::Object<Enemy>(createFromCatalog(catalog, static_cast<size_t>(row))));
+    }
+    return enemies;
+}
+
+/**
+ * @brief Creates an enemy for each of the specified names from the catalog of the Vijanden table.
+ *
+ * @param aNames The names of the enemies to create.
+ * @return Sean::Vector<Sean::Object<Enemy>> The created enemies in the order of the names, without the enemies that were not found.
+ */
+Sean::Vector<Sean::Object<Enemy>> EnemyFactory::createEnemies(const Sean::Vector<Sean::String> &aNames)
+{
+    Sean::Vector<Sean::Object<Enemy>> enemies;
+    if (aNames.empty())
+    {
+        return enemies;
+    }
+
+    const Catalog &catalog = getCatalog();
+    for (size_t i = 0; i < aNames.size(); ++i)
+    {
+        size_t row = catalog.mRows.find(aNames[i]);
+        if (row == NameIndex::NoRow)
+        {
+            std::cerr << "Enemy not found: " << aNames[i] << std::endl;
+            continue;
+        }
+        enemies.push_back(Sean::Object<Enemy>(createFromCatalog(catalog, row)));
+    }
+    return enemies;
+}
+
+/**
+ * @brief Spawns an enemy for each of the specified names straight into an entity store.
+ *
+ * The entities are filled from the rows of the catalog, so no Enemy is created and no string is copied.
+ * All names are looked up first, so either every enemy is spawned or none is.
+ *
+ * @param aNames The names of the enemies to spawn.
+ * @param aCount The number of names.
+ * @param aEntities The store to add the enemies to.
+ * @param aRoom The room index the enemies start in.
+ * @return bool True if the enemies were spawned, false if a name is not found.
+ */
+bool EnemyFactory::spawnEnemies(const char *const *aNames, size_t aCount, EntityStore &aEntities, uint32_t aRoom)
+{
+    const Catalog &catalog = getCatalog();
+    std::vector<uint32_t> kinds(aCount);
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        kinds[i] = findKind(aNames[i]);
+        if (kinds[i] == NoKind)
+        {
+            std::cerr << "Enemy not found: " << aNames[i] << std::endl;
+            return false;
+        }
+    }
+
+    RandomGenerator randomEngine;
+    for (uint32_t kind : kinds)
+    {
+        incrementCounter();
+        EntityStore::AttackStats attackStats = {catalog.mAttackPercents[kind], catalog.mMinDamages[kind], catalog.mMaxDamages[kind]};
+        aEntities.addEnemy(kind, mCounter, catalog.mHealths[kind], attackStats, catalog.mLootTables[kind], static_cast<uint32_t>(randomEngine.next()), aRoom);
+    }
+    return true;
+}
+
+/**
+ * @brief Finds the kind of an enemy, its row in the catalog of the Vijanden table.
+ *
+ * @param aName The name of the enemy, without its number.
+ * @return uint32_t The kind, or NoKind if the table has no enemy with the name.
+ */
+uint32_t EnemyFactory::findKind(const char *aName)
+{
+    size_t row = getCatalog().mRows.find(aName);
+    return row != NameIndex::NoRow ? static_cast<uint32_t>(row) : NoKind;
+}
+
+/**
+ * @brief Gets the name of a kind of enemy.
+ *
+ * @param aKind The kind, as returned by findKind.
+ * @return const Sean::String& The name, without a number.
+ */
+const Sean::String &EnemyFactory::getKindName(uint32_t aKind)
+{
+    return getCatalog().mNames[aKind];
+}
+
+/**
+ * @brief Gets the description of a kind of enemy.
+ *
+ * @param aKind The kind, as returned by findKind.
+ * @return const Sean::String& The description.
+ */
+const Sean::String &EnemyFactory::getKindDescription(uint32_t aKind)
+{
+    return getCatalog().mDescriptions[aKind];
+}
+
 void EnemyFactory::resetCounter()
 {
     mCounter = 0;
 }
 
+/**
+ * @brief Raises the counter so new enemies get IDs above an ID that is already in use.
+ *
+ * @param aMinimum The ID in use.
+ */
+void EnemyFactory::raiseCounter(int aMinimum)
+{
+    mCounter = std::max(mCounter, aMinimum);
+}
+
+/**
+ * @brief Gets the catalog of the Vijanden table, reading the table the first time.
+ *
+ * The database does not change while the game runs, so the table is read and indexed once and
+ * every batch afterwards creates its enemies from the same catalog.
+ *
+ * @return const Catalog& The catalog, empty if the database has no enemies.
+ * @throws std::runtime_error if the database could not be read.
+ */
+const EnemyFactory::Catalog &EnemyFactory::getCatalog()
+{
+    static const Catalog catalog = loadCatalog();
+    return catalog;
+}
+
+/**
+ * @brief Reads all rows of the Vijanden table, indexes them by name and looks up their loot tables.
+ *
+ * @return Catalog The catalog, empty if the database has no enemies.
+ * @throws std::runtime_error if the database could not be read.
+ */
+EnemyFactory::Catalog EnemyFactory::loadCatalog()
+{
+    Catalog catalog;
+    try
+    {
+        SQLReader::getInstance().getAllEnemies(catalog.mNames, catalog.mDescriptions, catalog.mHealths, catalog.mAttackPercents, catalog.mMinDamages, catalog.mMaxDamages);
+    }
+    catch (std::exception &e)
+    {
+        throw std::runtime_error(e.what());
+    }
+
+    catalog.mRows = NameIndex(catalog.mNames);
+    for (size_t i = 0; i < catalog.mNames.size(); ++i)
+    {
+        catalog.mLootTables.push_back(LootTables::getInstance().find(catalog.mNames[i]));
+    }
+    return catalog;
+}
+
+/**
+ * @brief Creates an enemy from a row of a catalog.
+ *
+ * @param aCatalog The catalog.
+ * @param aRow The index of the row.
+ * @return Enemy* The created enemy.
+ */
+Enemy *EnemyFactory::createFromCatalog(const Catalog &aCatalog, size_t aRow)
+{
+    incrementCounter();
+    return new Enemy(aCatalog.mNames[aRow], aCatalog.mDescriptions[aRow], aCatalog.mHealths[aRow], aCatalog.mAttackPercents[aRow], aCatalog.mMinDamages[aRow], aCatalog.mMaxDamages[aRow], mCounter);
+}
+
 /**
  * @brief Increments the internal counter for enemy IDs.
  */
@@ -0,0 +1,293 @@
+#include "EntityStore.h"
+#include "EnemyFactory.h"
+#include "LootTables.h"
+#include "RandomGenerator.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Adds an enemy to the store.
+ *
+ * @param aKind The row of the enemy in the catalog of EnemyFactory.
+ * @param aNumber The number shown after the name of the enemy.
+ * @param aHealth The health of the enemy.
+ * @param aAttackStats The attack stats of the enemy.
+ * @param aLootTable The loot table to roll the loot of the enemy from when it is taken, or LootTables::NoLoot.
+ * @param aLootSeed The seed to roll the loot with.
+ * @param aRoom The room index the enemy starts in.
+ * @return EntityId The ID of the new entity.
+ */
+EntityStore::EntityId EntityStore::addEnemy(uint32_t aKind, int aNumber, int aHealth, const AttackStats &aAttackStats, uint32_t aLootTable, uint32_t aLootSeed, uint32_t aRoom)
+{
+    EntityId entity = static_cast<EntityId>(mKinds.size());
+    mKinds.push_back(aKind);
+    mNumbers.push_back(aNumber);
+    mHealth.push_back(aHealth);
+    mAttackStats.push_back(aAttackStats);
+    mPositions.push_back(aRoom);
+    mLastSimulated.push_back(0);
+    mLootTables.push_back(aLootTable);
+    mLootSeeds.push_back(aLootSeed);
+    mRoomIndex[aRoom].push_back(entity);
+    return entity;
+}
+
+/**
+ * @brief Adds an enemy object to the store.
+ *
+ * The loot table and seed of the enemy are kept to roll its loot when it is taken.
+ *
+ * @param aEnemy The enemy to add.
+ * @param aRoom The room index the enemy starts in.
+ * @return EntityId The ID of the new entity.
+ * @throws std::invalid_argument if the enemy is not an enemy of the Vijanden table.
+ */
+EntityStore::EntityId EntityStore::addEnemy(Enemy &aEnemy, uint32_t aRoom)
+{
+    uint32_t kind = EnemyFactory::findKind(aEnemy.mName.c_str());
+    if (kind == EnemyFactory::NoKind)
+    {
+        throw std::invalid_argument(std::string("Unknown enemy: ") + aEnemy.mName.c_str());
+    }
+    return addEnemy(kind, aEnemy.mID, aEnemy.mHealth, {aEnemy.mAttackPercent, aEnemy.mMinimumDamage, aEnemy.mMaximumDamage}, aEnemy.mLootTable, aEnemy.mLootSeed, aRoom);
+}
+
+/**
+ * @brief Gets the number of entities.
+ *
+ * @return size_t The number of entities.
+ */
+size_t EntityStore::getEntityCount() const
+{
+    return mKinds.size();
+}
+
+/**
+ * @brief Gets the name of an entity.
+ *
+ * @param aEntity The entity.
+ * @return Sean::String The name and number of the entity, with "dode " prefix if the entity is dead.
+ */
+Sean::String EntityStore::getName(EntityId aEntity) const
+{
+    Sean::String name = EnemyFactory::getKindName(mKinds[aEntity]) + Sean::String(std::to_string(mNumbers[aEntity]).c_str());
+    if (isDead(aEntity))
+    {
+        return Sean::String("dode ") + name;
+    }
+    return name;
+}
+
+/**
+ * @brief Prints the name of an entity to the standard output.
+ *
+ * @param aEntity The entity.
+ */
+void EntityStore::printName(EntityId aEntity) const
+{
+    std::cout << getName(aEntity) << std::endl;
+}
+
+/**
+ * @brief Prints the description of an entity to the standard output.
+ *
+ * @param aEntity The entity.
+ */
+void EntityStore::printDescription(EntityId aEntity) const
+{
+    std::cout << EnemyFactory::getKindDescription(mKinds[aEntity]) << std::endl;
+}
+
+/**
+ * @brief Checks if an entity is dead.
+ *
+ * @param aEntity The entity.
+ * @return bool True if the health of the entity is less than or equal to 0, false otherwise.
+ */
+bool EntityStore::isDead(EntityId aEntity) const
+{
+    return mHealth[aEntity] <= 0;
+}
+
+/**
+ * @brief Gets the health of an entity.
+ *
+ * @param aEntity The entity.
+ * @return int The health of the entity.
+ */
+int EntityStore::getHealth(EntityId aEntity) const
+{
+    return mHealth[aEntity];
+}
+
+/**
+ * @brief Inflicts damage to an entity.
+ *
+ * @param aEntity The entity.
+ * @param aDamage The amount of damage to inflict. If the damage is greater than the health, the health is set to 0.
+ */
+void EntityStore::takeDamage(EntityId aEntity, int aDamage)
+{
+    if (aDamage < 0)
+    {
+        return;
+    }
+    mHealth[aEntity] = aDamage > mHealth[aEntity] ? 0 : mHealth[aEntity] - aDamage;
+}
+
+/**
+ * @brief Gets the attack value of an entity.
+ *
+ * @param aEntity The entity.
+ * @return int A random value between the minimum and maximum damage if the attack is successful, otherwise 0.
+ */
+int EntityStore::getAttack(EntityId aEntity) const
+{
+    const AttackStats &stats = mAttackStats[aEntity];
+    RandomGenerator randomEngine;
+    if (randomEngine.getChance(stats.mAttackPercent))
+    {
+        return randomEngine.getRandomValue(stats.mMinimumDamage, stats.mMaximumDamage);
+    }
+    return 0;
+}
+
+/**
+ * @brief Gets the attack stats of an entity.
+ *
+ * @param aEntity The entity.
+ * @return const AttackStats& The attack stats.
+ */
+const EntityStore::AttackStats &EntityStore::getAttackStats(EntityId aEntity) const
+{
+    return mAttackStats[aEntity];
+}
+
+/**
+ * @brief Gets the room an entity is in.
+ *
+ * @param aEntity The entity.
+ * @return uint32_t The room index.
+ */
+uint32_t EntityStore::getPosition(EntityId aEntity) const
+{
+    return mPositions[aEntity];
+}
+
+/**
+ * @brief Moves an entity to another room.
+ *
+ * @param aEntity The entity.
+ * @param aRoom The room index to move to.
+ */
+void EntityStore::setPosition(EntityId aEntity, uint32_t aRoom)
+{
+    if (mPositions[aEntity] == aRoom)
+    {
+        return;
+    }
+    removeFromRoom(aEntity, mPositions[aEntity]);
+    mPositions[aEntity] = aRoom;
+    mRoomIndex[aRoom].push_back(aEntity);
+}
+
+/**
+ * @brief Gets the turn up to which an entity was simulated.
+ *
+ * @param aEntity The entity.
+ * @return uint32_t The turn.
+ */
+uint32_t EntityStore::getLastSimulated(EntityId aEntity) const
+{
+    return mLastSimulated[aEntity];
+}
+
+/**
+ * @brief Sets the turn up to which an entity was simulated.
+ *
+ * @param aEntity The entity.
+ * @param aTurn The turn.
+ */
+void EntityStore::setLastSimulated(EntityId aEntity, uint32_t aTurn)
+{
+    mLastSimulated[aEntity] = aTurn;
+}
+
+/**
+ * @brief Gets the entities in a room.
+ *
+ * @param aRoom The room index.
+ * @return const std::vector<EntityId>& The entities, in order of arrival.
+ */
+const std::vector<EntityStore::EntityId> &EntityStore::getEntitiesIn(uint32_t aRoom) const
+{
+    static const std::vector<EntityId> noEntities;
+    auto iter = mRoomIndex.find(aRoom);
+    return iter != mRoomIndex.end() ? iter->second : noEntities;
+}
+
+/**
+ * @brief Finds an entity in a room by its name.
+ *
+ * @param aRoom The room index.
+ * @param aName The name of the entity, as returned by getName.
+ * @return EntityId The entity, or NoEntity if it is not found.
+ */
+EntityStore::EntityId EntityStore::findByName(uint32_t aRoom, const char *aName) const
+{
+    for (EntityId entity : getEntitiesIn(aRoom))
+    {
+        if (getName(entity) == aName)
+        {
+            return entity;
+        }
+    }
+    return NoEntity;
+}
+
+/**
+ * @brief Takes the loot of an entity, rolling the objects from its loot table.
+ *
+ * @param aEntity The entity.
+ * @return std::vector<ObjectValue> The loot, the entity has none left afterwards.
+ */
+std::vector<ObjectValue> EntityStore::takeLoot(EntityId aEntity)
+{
+    if (mLootTables[aEntity] == LootTables::NoLoot)
+    {
+        return {};
+    }
+    std::vector<ObjectValue> loot = LootTables::getInstance().createLoot(mLootTables[aEntity], mLootSeeds[aEntity]);
+    mLootTables[aEntity] = LootTables::NoLoot;
+    return loot;
+}
+
+// Private Methods
+
+/**
+ * @brief Removes an entity from the index of a room.
+ *
+ * @param aEntity The entity.
+ * @param aRoom The room index.
+ */
+void EntityStore::removeFromRoom(EntityId aEntity, uint32_t aRoom)
+{
+    auto iter = mRoomIndex.find(aRoom);
+    if (iter == mRoomIndex.end())
+    {
+        return;
+    }
+    std::vector<EntityId> &entities = iter->second;
+    auto entity = std::find(entities.begin(), entities.end(), aEntity);
+    if (entity != entities.end())
+    {
+        entities.erase(entity);
+    }
+    if (entities.empty())
+    {
+        mRoomIndex.erase(iter);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,287 @@
+#include "EventLog.h"
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Constructs the event log without an open file.
+ */
+EventLog::EventLog()
+{
+}
+
+/**
+ * @brief Gets the singleton instance of EventLog.
+ *
+ * @return EventLog& Reference to the singleton instance of EventLog.
+ */
+EventLog &EventLog::getInstance()
+{
+    static EventLog instance;
+    return instance;
+}
+
+/**
+ * @brief Destructor, writes the remaining events.
+ */
+EventLog::~EventLog()
+{
+    close();
+}
+
+/**
+ * @brief Opens a new log, closing the current one.
+ *
+ * @param aPath The path of the log, replaced if it exists.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void EventLog::open(const std::string &aPath)
+{
+    close();
+    mFile.open(aPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!mFile.is_open())
+    {
+        throw std::runtime_error("Failed to open file: " + aPath);
+    }
+    mPath = aPath;
+
+    BinaryFormat::EventHeader header;
+    memcpy(header.mMagic, BinaryFormat::EventMagic, sizeof(header.mMagic));
+    header.mVersion = BinaryFormat::EventVersion;
+    header.mStartTime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    mLastEvent = std::chrono::steady_clock::now();
+    mBuffer.reserve(WriteSize + 256);
+    mBuffer.insert(mBuffer.end(), reinterpret_cast<const char *>(&header), reinterpret_cast<const char *>(&header) + sizeof(header));
+}
+
+/**
+ * @brief Writes the remaining events and closes the log, if one is open.
+ */
+void EventLog::close()
+{
+    if (!mFile.is_open())
+    {
+        return;
+    }
+    flush();
+    mFile.close();
+}
+
+/**
+ * @brief Writes the buffered events to the file.
+ *
+ * Write errors are reported once on std::cerr, a broken log does not stop the game.
+ */
+void EventLog::flush()
+{
+    if (!mFile.is_open())
+    {
+        return;
+    }
+    if (!mFile.good())
+    {
+        mBuffer.clear();
+        return;
+    }
+    mFile.write(mBuffer.data(), mBuffer.size());
+    mFile.flush();
+    mBuffer.clear();
+    if (!mFile.good())
+    {
+        std::cerr << "Failed to write file: " << mPath << std::endl;
+    }
+}
+
+/**
+ * @brief Checks whether events are recorded.
+ *
+ * @return bool True if a log is open.
+ */
+bool EventLog::isOpen() const
+{
+    return mFile.is_open();
+}
+
+/**
+ * @brief Records a command entered by the player.
+ *
+ * @param aCommand The command line.
+ */
+void EventLog::logCommand(const std::string &aCommand)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    beginEvent(BinaryFormat::EventType::Command);
+    putText(aCommand.data(), aCommand.size());
+    endEvent();
+}
+
+/**
+ * @brief Records a move of the player.
+ *
+ * @param aFrom The room index the player left.
+ * @param aTo The room index the player entered.
+ */
+void EventLog::logMove(uint32_t aFrom, uint32_t aTo)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    beginEvent(BinaryFormat::EventType::Move);
+    putUnsigned(aFrom);
+    putUnsigned(aTo);
+    endEvent();
+}
+
+/**
+ * @brief Records an attack of the player on an enemy.
+ *
+ * @param aEnemy The name of the enemy.
+ * @param aDamage The damage dealt, 0 for a miss.
+ */
+void EventLog::logAttack(const char *aEnemy, int aDamage)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    beginEvent(BinaryFormat::EventType::Attack);
+    putText(aEnemy, strlen(aEnemy));
+    putSigned(aDamage);
+    endEvent();
+}
+
+/**
+ * @brief Records an attack of an enemy on the player.
+ *
+ * @param aEnemy The name of the enemy.
+ * @param aDamage The damage dealt, 0 for a miss.
+ */
+void EventLog::logDamage(const char *aEnemy, int aDamage)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    beginEvent(BinaryFormat::EventType::Damage);
+    putText(aEnemy, strlen(aEnemy));
+    putSigned(aDamage);
+    endEvent();
+}
+
+/**
+ * @brief Records an object picked up by the player.
+ *
+ * @param aObject The name of the object.
+ */
+void EventLog::logPickup(const char *aObject)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    beginEvent(BinaryFormat::EventType::Pickup);
+    putText(aObject, strlen(aObject));
+    endEvent();
+}
+
+/**
+ * @brief Records the death of an enemy or the player.
+ *
+ * @param aName The name of who died.
+ */
+void EventLog::logDeath(const char *aName)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    beginEvent(BinaryFormat::EventType::Death);
+    putText(aName, strlen(aName));
+    endEvent();
+}
+
+/**
+ * @brief Records the score a game ended with.
+ *
+ * @param aName The name of the player.
+ * @param aScore The gold of the player.
+ */
+void EventLog::logScore(const char *aName, int aScore)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+    beginEvent(BinaryFormat::EventType::Score);
+    putText(aName, strlen(aName));
+    putSigned(aScore);
+    endEvent();
+}
+
+// Private Methods
+
+/**
+ * @brief Starts an event with its kind and the time since the previous event.
+ *
+ * @param aType The kind of event.
+ */
+void EventLog::beginEvent(BinaryFormat::EventType aType)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    putUnsigned(static_cast<uint64_t>(aType));
+    putUnsigned(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - mLastEvent).count()));
+    mLastEvent = now;
+}
+
+/**
+ * @brief Ends an event, writing the buffered events once there are enough of them.
+ */
+void EventLog::endEvent()
+{
+    if (mBuffer.size() >= WriteSize)
+    {
+        flush();
+    }
+}
+
+/**
+ * @brief Appends an unsigned varint.
+ *
+ * @param aValue The value.
+ */
+void EventLog::putUnsigned(uint64_t aValue)
+{
+    while (aValue >= 0x80)
+    {
+        mBuffer.push_back(static_cast<char>((aValue & 0x7F) | 0x80));
+        aValue >>= 7;
+    }
+    mBuffer.push_back(static_cast<char>(aValue));
+}
+
+/**
+ * @brief Appends a signed varint, zigzag encoded so small negative values stay short.
+ *
+ * @param aValue The value.
+ */
+void EventLog::putSigned(int64_t aValue)
+{
+    putUnsigned((static_cast<uint64_t>(aValue) << 1) ^ static_cast<uint64_t>(aValue >> 63));
+}
+
+/**
+ * @brief Appends a string as its varint length followed by its characters.
+ *
+ * @param aText The characters.
+ * @param aLength The number of characters.
+ */
+void EventLog::putText(const char *aText, size_t aLength)
+{
+    putUnsigned(aLength);
+    mBuffer.insert(mBuffer.end(), aText, aText + aLength);
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "EventReader.h"
+
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * @brief Names of the kinds of event, by EventType.
+ */
+static const char *const EventNames[static_cast<size_t>(BinaryFormat::EventType::Count)] = {
+    "command", "move", "attack", "damage", "pickup", "death", "score"};
+
+/**
+ * @brief Opens an event log.
+ *
+ * @param aPath The path of the event log.
+ * @throws std::runtime_error if the file cannot be read or is not an event log.
+ */
+EventReader::EventReader(const char *aPath)
+    : mFile(aPath), mOffset(sizeof(BinaryFormat::EventHeader)), mStart(0), mTime(0)
+{
+    BinaryFormat::EventHeader header;
+    if (mFile.getSize() < sizeof(header))
+    {
+        throw std::runtime_error("Invalid event log: truncated");
+    }
+    memcpy(&header, mFile.getData(), sizeof(header));
+    if (memcmp(header.mMagic, BinaryFormat::EventMagic, sizeof(header.mMagic)) != 0)
+    {
+        throw std::runtime_error("Invalid event log: wrong magic");
+    }
+    if (header.mVersion != BinaryFormat::EventVersion)
+    {
+        throw std::runtime_error("Invalid event log: unsupported version " + std::to_string(header.mVersion));
+    }
+    mStart = header.mStartTime;
+    mTime = mStart;
+}
+
+/**
+ * @brief Reads the next event.
+ *
+ * @param aEvent The event to fill in.
+ * @return bool True if an event was read, false at the end of the log.
+ * @throws std::runtime_error if the log is truncated or holds an unknown kind of event.
+ */
+bool EventReader::next(Event &aEvent)
+{
+    if (mOffset == mFile.getSize())
+    {
+        return false;
+    }
+
+    uint64_t type = getUnsigned();
+    if (type >= static_cast<uint64_t>(BinaryFormat::EventType::Count))
+    {
+        throw std::runtime_error("Invalid event log: unknown event " + std::to_string(type));
+    }
+    aEvent.mType = static_cast<BinaryFormat::EventType>(type);
+    mTime += getUnsigned();
+    aEvent.mTime = mTime;
+
+    aEvent.mFields.clear();
+    for (const char *field = BinaryFormat::EventFields[type]; *field != '\0'; ++field)
+    {
+        switch (*field)
+        {
+        case 'u':
+            aEvent.mFields.push_back(std::to_string(getUnsigned()));
+            break;
+        case 'i':
+            aEvent.mFields.push_back(std::to_string(getSigned()));
+            break;
+        default:
+            aEvent.mFields.push_back(getText());
+            break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Gets the time the log was opened.
+ *
+ * @return uint64_t Microseconds since the Unix epoch.
+ */
+uint64_t EventReader::getStartTime() const
+{
+    return mStart;
+}
+
+/**
+ * @brief Gets the name of a kind of event.
+ *
+ * @param aType The kind of event.
+ * @return const char* The name, such as "move".
+ * @throws std::out_of_range if the kind is unknown.
+ */
+const char *EventReader::getTypeName(BinaryFormat::EventType aType)
+{
+    if (aType >= BinaryFormat::EventType::Count)
+    {
+        throw std::out_of_range("Unknown event type");
+    }
+    return EventNames[static_cast<size_t>(aType)];
+}
+
+// Private Methods
+
+/**
+ * @brief Reads an unsigned varint.
+ *
+ * @return uint64_t The value.
+ * @throws std::runtime_error if the log ends within the varint or it is too long.
+ */
+uint64_t EventReader::getUnsigned()
+{
+    uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        if (mOffset == mFile.getSize())
+        {
+            throw std::runtime_error("Invalid event log: truncated");
+        }
+        uint8_t byte = static_cast<uint8_t>(mFile.getData()[mOffset++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    throw std::runtime_error("Invalid event log: varint too long");
+}
+
+/**
+ * @brief Reads a zigzag encoded signed varint.
+ *
+ * @return int64_t The value.
+ * @throws std::runtime_error if the log ends within the varint.
+ */
+int64_t EventReader::getSigned()
+{
+    uint64_t value = getUnsigned();
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+/**
+ * @brief Reads a string stored as its varint length followed by its characters.
+ *
+ * @return std::string The string.
+ * @throws std::runtime_error if the log ends within the string.
+ */
+std::string EventReader::getText()
+{
+    uint64_t length = getUnsigned();
+    if (length > mFile.getSize() - mOffset)
+    {
+        throw std::runtime_error("Invalid event log: truncated");
+    }
+    std::string text(mFile.getData() + mOffset, static_cast<size_t>(length));
+    mOffset += static_cast<size_t>(length);
+    return text;
+}
\ No newline at end of file
@@ -1,19 +1,24 @@
 #include "Game.h"
 
 #include "XmlReader.h"
+#include "BinaryReader.h"
 #include "IGameObject.h"
 #include "SqlReader.h"
+#include "RandomGenerator.h"
+#include "EventLog.h"
 
 #include "LocationFactory.h"
 #include "GameObjectFactory.h"
 #include "EnemyFactory.h"
 
+#include <filesystem>
 #include <iostream>
 #include <string>
 #include <unordered_map>
 #include <sstream>
 #include <limits>
 #include <utility>
+#include <vector>
 
 /**
  * @brief Clears the console screen.
@@ -21,6 +26,10 @@
 void clearConsole()
 {
     std::cout << std::endl; //Add so log has enter between each command
+    if (!Sean::Logger::hasConsoleOutput())
+    {
+        return;
+    }
     // Temporarily restore the original std::cout buffer
     std::streambuf *originalCoutBuf = Sean::Logger::getOriginalCoutBuf();
     std::cout.rdbuf(originalCoutBuf);
@@ -31,21 +40,81 @@ void clearConsole()
     Sean::Logger::replaceCoutCin();
 }
 
+/**
+ * @brief Stops reading when the input has ended, such as at the end of a replayed session.
+ *
+ * @throws std::runtime_error if the last read failed because there is no more input.
+ */
+static void checkInput()
+{
+    if (std::cin.fail() && std::cin.eof())
+    {
+        throw std::runtime_error("Einde van de invoer");
+    }
+}
+
 /*
  * @brief Constructor for Game.
  */
 Game::Game()
-    : mPlayer(nullptr), mDungeon(nullptr), mQuit(false)
+    : mPlayer(nullptr), mDungeon(nullptr), mRecorder(nullptr), mReplay(nullptr), mQuit(false)
 {
     Sean::Logger::replaceCoutCin();
 }
 
+/**
+ * @brief Destructor for Game, reads from and writes to the console again.
+ */
+Game::~Game()
+{
+    Sean::Logger::setInputBuf(nullptr);
+    Sean::Logger::setConsoleOutput(true);
+}
+
+/**
+ * @brief Records the session to a file, so it can be replayed later.
+ *
+ * The RandomGenerator is given a fresh seed that is stored with the input that is read.
+ *
+ * @param aPath The path of the recorded session.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void Game::recordSession(const std::string &aPath)
+{
+    RandomGenerator randomEngine;
+    uint64_t seed = randomEngine.next();
+    mRecorder = std::make_unique<SessionRecorder>(aPath.c_str(), seed, Sean::Logger::getOriginalCinBuf());
+    RandomGenerator::seed(seed);
+    Sean::Logger::setInputBuf(mRecorder->getInputBuf());
+}
+
+/**
+ * @brief Replays a recorded session headless, with the same outcome as when it was recorded.
+ *
+ * The output only goes to the log file and the game ends when the recorded input runs out.
+ *
+ * @param aPath The path of the recorded session.
+ * @throws std::runtime_error if the session cannot be read or its dungeon file is missing.
+ */
+void Game::replaySession(const std::string &aPath)
+{
+    mReplay = std::make_unique<SessionReplay>(aPath.c_str());
+    if (mReplay->getSource() == BinaryFormat::SessionSource::Loaded && !std::filesystem::exists(mReplay->getSourceText()))
+    {
+        throw std::runtime_error("Kerker van de opname niet gevonden: " + mReplay->getSourceText());
+    }
+    RandomGenerator::seed(mReplay->getSeed());
+    Sean::Logger::setInputBuf(mReplay->getInputBuf());
+    Sean::Logger::setConsoleOutput(false);
+}
+
 /**
  * @brief Runs the main game loop.
  */
 void Game::run()
 {
     Sean::Logger::createLogFile();
+    EventLog::getInstance().open(Sean::Logger::getLogFolder() + "/GameEvents_" + Sean::Logger::getCurrentDateTime() + ".evt");
     clearConsole();
     try
     {
@@ -62,10 +131,14 @@ void Game::run()
     catch (const std::runtime_error &e)
     {
         std::cerr << e.what() << std::endl;
+        Sean::Logger::flush();
+        EventLog::getInstance().flush();
         return;
     }
 
     clearConsole();
+    Sean::Logger::flush();
+    EventLog::getInstance().flush();
 }
 
 /**
@@ -87,6 +160,7 @@ void Game::initialize()
     {
         std::cout << "Wilt u een kerker laden of genereren? (laden/genereren): ";
         std::cin >> choice;
+        checkInput();
 
         try
         {
@@ -115,12 +189,13 @@ void Game::initialize()
     mPlayer = std::make_unique<Player>();
     auto dolk = std::unique_ptr<IGameObject>(mDungeon->createGameObject(StartingWeapon.c_str()));
     std::string weaponName = dolk->getName().c_str();
-    mPlayer->addObject(std::move(dolk));
-    mPlayer->equipObject(weaponName.c_str());
+    ObjectValue previousItem;
+    mPlayer->addObject(dolk->getObjectValue());
+    mPlayer->equipObject(weaponName.c_str(), previousItem);
 }
 
 /**
- * @brief Loads the dungeon from an XML file.
+ * @brief Loads the dungeon from an XML file or a compiled dungeon file.
  */
 void Game::loadDungeon()
 {
@@ -128,8 +203,9 @@ void Game::loadDungeon()
     std::string path;
     while (true)
     {
-        std::cout << "Wilt u een standaard XML-bestand laden of een eigen XML-bestand? (standaard/eigen): ";
+        std::cout << "Wilt u een standaard XML-bestand laden of een eigen XML- of gecompileerd bestand? (standaard/eigen): ";
         std::cin >> xmlChoice;
+        checkInput();
 
         if (xmlChoice == "standaard")
         {
@@ -140,6 +216,7 @@ void Game::loadDungeon()
         {
             std::cout << "Geef het pad naar het bestand: ";
             std::cin >> path;
+            checkInput();
             break;
         }
         else
@@ -147,11 +224,23 @@ void Game::loadDungeon()
             std::cout << "Ongeldige keuze. Probeer het opnieuw." << std::endl;
         }
     }
+    if (mRecorder)
+    {
+        mRecorder->recordSource(BinaryFormat::SessionSource::Loaded, path);
+    }
     try
     {
-        XmlReader xmlReader(path.c_str());
-        std::vector<Sean::ParsedLocations> locations = xmlReader.getLocations();
-        mDungeon->createDungeon(locations);
+        if (BinaryReader::isBinaryFile(path.c_str()))
+        {
+            BinaryReader binaryReader(path.c_str());
+            mDungeon->createDungeon(binaryReader.getLayout());
+        }
+        else
+        {
+            XmlReader xmlReader(path.c_str());
+            std::vector<Sean::ParsedLocations> locations = xmlReader.getLocations();
+            mDungeon->createDungeon(locations);
+        }
     }
     catch (const std::runtime_error &e)
     {
@@ -167,10 +256,11 @@ void Game::generateDungeon()
     int locations;
     while (true)
     {
-        std::cout << "Geeft aantal locaties op (1-20): ";
+        std::cout << "Geeft aantal locaties op (1-" << MaxGeneratedLocations << "): ";
         std::cin >> locations;
+        checkInput();
 
-        if (std::cin.fail() || locations <= 0 || locations > 20)
+        if (std::cin.fail() || locations <= 0 || locations > MaxGeneratedLocations)
         {
             std::cin.clear();                                                   // Clear the error flag
             std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); // Discard invalid input
@@ -182,6 +272,10 @@ void Game::generateDungeon()
         }
     }
 
+    if (mRecorder)
+    {
+        mRecorder->recordSource(BinaryFormat::SessionSource::Generated, std::to_string(locations));
+    }
     try
     {
         mDungeon->generateDungeon(locations);
@@ -216,7 +310,12 @@ void Game::playerInput()
     std::string input;
 
     std::cout << "Voer een actie in: ";
-    std::getline(std::cin, input);
+    if (!std::getline(std::cin, input))
+    {
+        mQuit = true;
+        return;
+    }
+    EventLog::getInstance().logCommand(input);
 
     size_t spacePos = input.find(' ');
     std::string action = input.substr(0, spacePos);
@@ -268,6 +367,12 @@ void Game::playerInput()
         case PlayerAction::Godmode:
             godmodeAction();
             break;
+        case PlayerAction::Opslaan:
+            saveAction(argument);
+            break;
+        case PlayerAction::Herstel:
+            restoreAction(argument);
+            break;
         case PlayerAction::Quit:
             mQuit = true;
             break;
@@ -304,6 +409,8 @@ PlayerAction Game::getPlayerAction(const std::string &aAction) const
         {"consumeer", PlayerAction::Consumeer},
         {"help", PlayerAction::Help},
         {"godmode", PlayerAction::Godmode},
+        {"opslaan", PlayerAction::Opslaan},
+        {"herstel", PlayerAction::Herstel},
         {"quit", PlayerAction::Quit}};
 
     auto it = actionMap.find(aAction);
@@ -356,6 +463,13 @@ void Game::searchAction()
  */
 void Game::goAction(const std::string &aDirection)
 {
+    const std::string travelPrefix = "naar ";
+    if (aDirection.compare(0, travelPrefix.size(), travelPrefix) == 0)
+    {
+        travelAction(aDirection.substr(travelPrefix.size()));
+        return;
+    }
+
     Sean::Direction direction;
     if (aDirection == "noord")
     {
@@ -396,6 +510,41 @@ void Game::goAction(const std::string &aDirection)
     printCurrentLocation();
 }
 
+/**
+ * @brief Executes the travel action, walking the shortest route to a location.
+ *
+ * Every step is a turn, so enemies get to attack on the way just as with single moves.
+ *
+ * @param aLocation The name of the location to travel to.
+ */
+void Game::travelAction(const std::string &aLocation)
+{
+    std::vector<Sean::Direction> route;
+    if (!mDungeon->findRoute(aLocation.c_str(), route))
+    {
+        std::cout << "Er is geen bereikbare locatie met de naam " << aLocation << std::endl;
+        return;
+    }
+    if (route.empty())
+    {
+        std::cout << "Je bent al in " << aLocation << std::endl;
+        return;
+    }
+
+    for (Sean::Direction direction : route)
+    {
+        updateDungeon();
+        if (mQuit)
+        {
+            return;
+        }
+        mDungeon->moveLocation(direction);
+    }
+    clearConsole();
+    std::cout << "Je bent in " << route.size() << " stappen naar " << aLocation << " gereisd" << std::endl;
+    printCurrentLocation();
+}
+
 /**
  * @brief Executes the take action, picking up the specified object.
  *
@@ -403,10 +552,11 @@ void Game::goAction(const std::string &aDirection)
  */
 void Game::takeAction(const std::string &aObject)
 {
-    std::unique_ptr<IGameObject> object(mDungeon->pickUpObject(aObject.c_str()));
-    if (object)
+    ObjectValue object;
+    if (mDungeon->pickUpObject(aObject.c_str(), object))
     {
-        mPlayer->addObject(std::move(object));
+        EventLog::getInstance().logPickup(object.getName().c_str());
+        mPlayer->addObject(object);
     }
     else
     {
@@ -421,10 +571,10 @@ void Game::takeAction(const std::string &aObject)
  */
 void Game::dropAction(const std::string &aObject)
 {
-    auto item = mPlayer->dropObject(aObject.c_str());
-    if (item)
+    ObjectValue item;
+    if (mPlayer->dropObject(aObject.c_str(), item))
     {
-        mDungeon->placeObject(std::move(item));
+        mDungeon->placeObject(item);
     }
     else
     {
@@ -481,10 +631,10 @@ void Game::hitAction(const std::string &aTarget)
  */
 void Game::wearAction(const std::string &aObject)
 {
-    auto previousItem = mPlayer->equipObject(aObject.c_str());
-    if (previousItem)
+    ObjectValue previousItem;
+    if (mPlayer->equipObject(aObject.c_str(), previousItem))
     {
-        if (mDungeon->placeObject(std::move(previousItem)))
+        if (mDungeon->placeObject(previousItem))
         {
             updateDungeon(); // Only update if the object was placed in the dungeon
         }
@@ -506,36 +656,34 @@ void Game::waitAction()
  */
 void Game::consumeAction(const std::string &aObject)
 {
-    for (auto iter = mPlayer->getInventory().begin(); iter != mPlayer->getInventory().end(); ++iter)
+    const ObjectValue *item = mPlayer->findObject(aObject.c_str());
+    if (item != nullptr)
     {
-        if (iter->get()->getName().c_str() == aObject)
+        if (item->isConsumableHealth())
         {
-            if (iter->get()->isConsumableHealth())
-            {
-                mPlayer->addHealth(iter->get()->getValue());
-                std::cout << "Je hebt " << aObject << " geconsumeerd en je levenspunten zijn nu " << mPlayer->getHealth() << std::endl;
-                mPlayer->getInventory().erase(iter);
-                return;
-            }
-            else if (iter->get()->isConsumableExperience())
-            {
-                mPlayer->addExperience(iter->get()->getValue());
-                std::cout << "Je hebt " << aObject << " geconsumeerd en je aanvalskans is nu " << mPlayer->getAttackPercentage() << "%" << std::endl;
-                mPlayer->getInventory().erase(iter);
-                return;
-            }
-            else if (iter->get()->isConsumableTeleport())
-            {
-                mDungeon->teleport(iter->get()->getValue());
-                std::cout << "Je hebt " << aObject << " geconsumeerd en je bent geteleporteerd naar een andere locatie" << std::endl;
-                mPlayer->getInventory().erase(iter);
-                return;
-            }
-            else
-            {
-                std::cout << "Je kunt " << aObject << " niet consumeren" << std::endl;
-                return;
-            }
+            mPlayer->addHealth(item->getValue());
+            std::cout << "Je hebt " << aObject << " geconsumeerd en je levenspunten zijn nu " << mPlayer->getHealth() << std::endl;
+            mPlayer->removeObject(item);
+            return;
+        }
+        else if (item->isConsumableExperience())
+        {
+            mPlayer->addExperience(item->getValue());
+            std::cout << "Je hebt " << aObject << " geconsumeerd en je aanvalskans is nu " << mPlayer->getAttackPercentage() << "%" << std::endl;
+            mPlayer->removeObject(item);
+            return;
+        }
+        else if (item->isConsumableTeleport())
+        {
+            mDungeon->teleport(item->getValue());
+            std::cout << "Je hebt " << aObject << " geconsumeerd en je bent geteleporteerd naar een andere locatie" << std::endl;
+            mPlayer->removeObject(item);
+            return;
+        }
+        else
+        {
+            std::cout << "Je kunt " << aObject << " niet consumeren" << std::endl;
+            return;
         }
     }
     std::cout << "Object " << aObject << " niet gevonden in je inventory" << std::endl;
@@ -550,6 +698,7 @@ void Game::helpAction() const
     std::cout << "kijk - Om je heen kijken" << std::endl;
     std::cout << "zoek* - Zoeken in de omgeving" << std::endl;
     std::cout << "ga* <noord|oost|zuid|west> - Naar een andere locatie gaan" << std::endl;
+    std::cout << "ga* naar <locatie> - Via de kortste route naar een locatie reizen" << std::endl;
     std::cout << "pak <item> - Een object oppakken" << std::endl;
     std::cout << "leg <item> - Een object neerleggen" << std::endl;
     std::cout << "bekijk <object> - Een object bekijken" << std::endl;
@@ -561,6 +710,8 @@ void Game::helpAction() const
     std::cout << "consumeer <object> - Een object consumeren" << std::endl;
     std::cout << "help - Deze helptekst tonen" << std::endl;
     std::cout << "godmode - Godmode toggelen" << std::endl;
+    std::cout << "opslaan [bestand] - Het spel opslaan" << std::endl;
+    std::cout << "herstel [bestand] - Een opgeslagen spel herstellen" << std::endl;
     std::cout << "quit - Het spel verlaten" << std::endl;
 }
 
@@ -572,11 +723,41 @@ void Game::godmodeAction()
     mPlayer->toggleGodMode();
 }
 
+/**
+ * @brief Saves the game to a file.
+ *
+ * @param aPath The path of the saved game, DefaultSaveFile if empty.
+ */
+void Game::saveAction(const std::string &aPath)
+{
+    std::string path = aPath.empty() ? DefaultSaveFile : aPath;
+    mDungeon->saveGame(path.c_str(), *mPlayer);
+    std::cout << "Het spel is opgeslagen in " << path << std::endl;
+    Sean::Logger::flush();
+    EventLog::getInstance().flush();
+}
+
+/**
+ * @brief Restores a saved game, replacing the current dungeon and player.
+ *
+ * @param aPath The path of the saved game, DefaultSaveFile if empty.
+ */
+void Game::restoreAction(const std::string &aPath)
+{
+    std::string path = aPath.empty() ? DefaultSaveFile : aPath;
+    mDungeon->loadGame(path.c_str(), *mPlayer);
+    clearConsole();
+    std::cout << "Het spel uit " << path << " is hersteld" << std::endl;
+    printCurrentSetting();
+}
+
 /**
  * @brief Ends the game, displaying the player's score and high scores.
  */
 void Game::endGame()
 {
+    EventLog::getInstance().logDeath(mPlayer->getName().c_str());
+    EventLog::getInstance().logScore(mPlayer->getName().c_str(), mPlayer->getGold());
     SQLReader &sqlReader = SQLReader::getInstance();
     sqlReader.putHighscore(mPlayer->getName().c_str(), mPlayer->getGold());
     std::pair<Sean::String, int> highscore[10];
@@ -604,12 +785,19 @@ void Game::endGame()
         std::cout << "\t" << i + 1 << ". " << highscore[i].first << " - " << highscore[i].second << std::endl;
     }
     std::cout << "Bedankt voor het spelen!" << std::endl;
+    Sean::Logger::flush();
+    EventLog::getInstance().flush();
 
     std::string choice;
     while (true)
     {
         std::cout << "Wilt u opnieuw spelen of stoppen? (opnieuw/quit): ";
         std::cin >> choice;
+        if (std::cin.fail() && std::cin.eof())
+        {
+            mQuit = true;
+            return;
+        }
 
         if (choice == "opnieuw")
         {
@@ -1,4 +1,5 @@
 #include "GameObject.h"
+#include "ObjectPool.h"
 #include <iostream>
 #include <utility>
 
@@ -10,10 +11,22 @@
  * @param aName The name of the object.
  * @param aDescription The description of the object.
  * @param aType The type of the object.
+ * @param aMinimum The minimum value of the object.
+ * @param aMaximum The maximum value of the object.
  * @param aID The ID of the object.
  */
-GameObject::GameObject(const Sean::String &aName, const Sean::String &aDescription, ObjectType aType, int aID)
-    : mName(aName), mDescription(aDescription), mType(aType), mID(aID)
+GameObject::GameObject(const Sean::String &aName, const Sean::String &aDescription, ObjectType aType, int aMinimum, int aMaximum, int aID)
+    : mValue(ObjectTemplates::getInstance().intern(aName, aDescription, aType, aMinimum, aMaximum), aID)
+{
+}
+
+/**
+ * @brief Constructs a GameObject that wraps an object value.
+ * 
+ * @param aValue The value of the object.
+ */
+GameObject::GameObject(const ObjectValue &aValue)
+    : mValue(aValue)
 {
 }
 
@@ -23,7 +36,7 @@ GameObject::GameObject(const Sean::String &aName, const Sean::String &aDescripti
  * @param other The GameObject to copy.
  */
 GameObject::GameObject(const GameObject &other)
-    : mName(other.mName), mID(other.mID), mDescription(other.mDescription), mType(other.mType)
+    : mValue(other.mValue)
 {
 }
 
@@ -33,10 +46,9 @@ GameObject::GameObject(const GameObject &other)
  * @param other The GameObject to move.
  */
 GameObject::GameObject(GameObject &&other) noexcept
-    : mName(std::move(other.mName)), mID(other.mID), mDescription(std::move(other.mDescription)), mType(other.mType)
+    : mValue(other.mValue)
 {
-    other.mID = 0;
-    other.mType = ObjectType::Gold; // Default type
+    other.mValue = ObjectValue();
 }
 
 // Assignment Operators
@@ -51,10 +63,7 @@ GameObject &GameObject::operator=(const GameObject &other)
 {
     if (this != &other)
     {
-        mName = other.mName;
-        mID = other.mID;
-        mDescription = other.mDescription;
-        mType = other.mType;
+        mValue = other.mValue;
     }
     return *this;
 }
@@ -69,17 +78,36 @@ GameObject &GameObject::operator=(GameObject &&other) noexcept
 {
     if (this != &other)
     {
-        mName = std::move(other.mName);
-        mID = other.mID;
-        mDescription = std::move(other.mDescription);
-        mType = other.mType;
-
-        other.mID = 0;
-        other.mType = ObjectType::Gold; // Default type
+        mValue = other.mValue;
+        other.mValue = ObjectValue();
     }
     return *this;
 }
 
+// Allocation
+
+/**
+ * @brief Allocates the memory for a game object from the GameObject pool.
+ * 
+ * @param aSize The size of the object.
+ * @return void* The memory.
+ */
+void *GameObject::operator new(std::size_t aSize)
+{
+    return ObjectPool<GameObject>::allocate(aSize);
+}
+
+/**
+ * @brief Returns the memory of a game object to the GameObject pool.
+ * 
+ * @param aObject The memory of the object.
+ * @param aSize The size of the object.
+ */
+void GameObject::operator delete(void *aObject, std::size_t aSize)
+{
+    ObjectPool<GameObject>::deallocate(aObject, aSize);
+}
+
 // Methods
 
 /**
@@ -89,7 +117,7 @@ GameObject &GameObject::operator=(GameObject &&other) noexcept
  */
 Sean::String GameObject::getName() const
 {
-    return mName + (std::to_string(mID).c_str());
+    return mValue.getName();
 }
 
 /**
@@ -97,7 +125,7 @@ Sean::String GameObject::getName() const
  */
 void GameObject::printName() const
 {
-    std::cout << getName() << std::endl;
+    mValue.printName();
 }
 
 /**
@@ -107,7 +135,7 @@ void GameObject::printName() const
  */
 bool GameObject::isWeapon() const
 {
-    return mType == ObjectType::Weapon;
+    return mValue.isWeapon();
 }
 
 /**
@@ -117,7 +145,7 @@ bool GameObject::isWeapon() const
  */
 bool GameObject::isArmor() const
 {
-    return mType == ObjectType::Armor;
+    return mValue.isArmor();
 }
 
 /**
@@ -127,7 +155,7 @@ bool GameObject::isArmor() const
  */
 bool GameObject::isConsumableHealth() const
 {
-    return mType == ObjectType::Consumable_Health;
+    return mValue.isConsumableHealth();
 }
 
 /**
@@ -137,7 +165,7 @@ bool GameObject::isConsumableHealth() const
  */
 bool GameObject::isConsumableExperience() const
 {
-    return mType == ObjectType::Consumable_Experience;
+    return mValue.isConsumableExperience();
 }
 
 /**
@@ -147,7 +175,7 @@ bool GameObject::isConsumableExperience() const
  */
 bool GameObject::isConsumableTeleport() const
 {
-    return mType == ObjectType::Consumable_Teleport;
+    return mValue.isConsumableTeleport();
 }
 
 /**
@@ -157,7 +185,7 @@ bool GameObject::isConsumableTeleport() const
  */
 bool GameObject::isMoney() const
 {
-    return mType == ObjectType::Gold;
+    return mValue.isMoney();
 }
 
 /**
@@ -167,7 +195,37 @@ bool GameObject::isMoney() const
  */
 ObjectType GameObject::getType() const
 {
-    return mType;
+    return mValue.getType();
+}
+
+/**
+ * @brief Gets the index of the template of the object.
+ * 
+ * @return uint32_t The index in ObjectTemplates.
+ */
+uint32_t GameObject::getTemplateId() const
+{
+    return mValue.getTemplateId();
+}
+
+/**
+ * @brief Gets the template with the name, description, type and value range of the object.
+ * 
+ * @return const ObjectTemplates::Template& The template.
+ */
+const ObjectTemplates::Template &GameObject::getTemplate() const
+{
+    return mValue.getTemplate();
+}
+
+/**
+ * @brief Gets the object as a value, for example to store it without allocating.
+ * 
+ * @return const ObjectValue& The value of the object.
+ */
+const ObjectValue &GameObject::getObjectValue() const
+{
+    return mValue;
 }
 
 // Private Methods
@@ -179,8 +237,5 @@ ObjectType GameObject::getType() const
  */
 void GameObject::swap(GameObject &other) noexcept
 {
-    std::swap(mName, other.mName);
-    std::swap(mID, other.mID);
-    std::swap(mDescription, other.mDescription);
-    std::swap(mType, other.mType);
+    std::swap(mValue, other.mValue);
 }
\ No newline at end of file
@@ -1,11 +1,11 @@
 #include "GameObjectFactory.h"
 
-#include "GoldObject.h"
-#include "WeaponObject.h"
-#include "ArmorObject.h"
-#include "ConsumableObject.h"
+#include "ObjectTypeRegistry.h"
+#include "RandomGenerator.h"
 #include "SqlReader.h"
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 int GameObjectFactory::mCounter = 0;
 
@@ -17,48 +17,16 @@ int GameObjectFactory::mCounter = 0;
  */
 GameObject *GameObjectFactory::createGameObject(const Sean::String &aObjectName)
 {
-    Sean::String name = aObjectName;
-    Sean::String description;
-    Sean::String type;
-    int minValue;
-    int maxValue;
-    int protection;
-
-    try
+    const Catalog &catalog = getCatalog();
+    size_t row = catalog.mRows.find(aObjectName);
+    if (row != NameIndex::NoRow)
     {
-        if (SQLReader::getInstance().getObjectInfo(name, description, type, minValue, maxValue, protection))
+        GameObject *object = createFromCatalog(catalog, row);
+        if (object != nullptr)
         {
-            incrementCounter();
-            if (type == "goudstukken")
-            {
-                return new GoldObject(name, description, minValue, maxValue, ObjectType::Gold, mCounter);
-            }
-            else if (type == "wapen")
-            {
-                return new WeaponObject(name, description, minValue, maxValue, ObjectType::Weapon, mCounter);
-            }
-            else if (type == "wapenrusting")
-            {
-                return new ArmorObject(name, description, protection, ObjectType::Armor, mCounter);
-            }
-            else if (type == "levenselixer" || type == "ervaringsdrank" || type == "teleportatiedrank")
-            {
-                ObjectType consumableType;
-                if (type == "levenselixer")
-                    consumableType = ObjectType::Consumable_Health;
-                else if (type == "ervaringsdrank")
-                    consumableType = ObjectType::Consumable_Experience;
-                else
-                    consumableType = ObjectType::Consumable_Teleport;
-
-                return new ConsumableObject(name, description, minValue, maxValue, consumableType, mCounter);
-            }
+            return object;
         }
     }
-    catch (std::exception &e)
-    {
-        throw std::runtime_error(e.what());
-    }
     std::cerr << "Object not found: " << aObjectName << std::endl;
     return nullptr;
 }
@@ -82,30 +50,10 @@ GameObject *GameObjectFactory::createGameObject()
     {
         if (sqlReader.getRandomObject(name, description, type, minValue, maxValue, protection))
         {
-            incrementCounter();
-            if (type == "goudstukken")
-            {
-                return new GoldObject(name, description, minValue, maxValue, ObjectType::Gold, mCounter);
-            }
-            else if (type == "wapen")
-            {
-                return new WeaponObject(name, description, minValue, maxValue, ObjectType::Weapon, mCounter);
-            }
-            else if (type == "wapenrusting")
-            {
-                return new ArmorObject(name, description, protection, ObjectType::Armor, mCounter);
-            }
-            else if (type == "levenselixer" || type == "ervaringsdrank" || type == "teleportatiedrank")
+            GameObject *object = createFromRow(name, description, type, minValue, maxValue, protection);
+            if (object != nullptr)
             {
-                ObjectType consumableType;
-                if (type == "levenselixer")
-                    consumableType = ObjectType::Consumable_Health;
-                else if (type == "ervaringsdrank")
-                    consumableType = ObjectType::Consumable_Experience;
-                else
-                    consumableType = ObjectType::Consumable_Teleport;
-
-                return new ConsumableObject(name, description, minValue, maxValue, consumableType, mCounter);
+                return object;
             }
         }
     }
@@ -117,6 +65,105 @@ GameObject *GameObjectFactory::createGameObject()
     return nullptr;
 }
 
+/**
+ * @brief Creates a number of random GameObjects from the catalog of the Objecten table.
+ *
+ * The objects are allocated one after the other from the GameObject pool, so a batch is laid out
+ * close together in memory.
+ *
+ * @param aCount The number of objects to create.
+ * @return Sean::Vector<Sean::Object<GameObject>> The created objects, empty if the database has no objects.
+ */
+Sean::Vector<Sean::Object<GameObject>> GameObjectFactory::createGameObjects(int aCount)
+{
+    Sean::Vector<Sean::Object<GameObject>> objects;
+    if (aCount <= 0)
+    {
+        return objects;
+    }
+
+    const Catalog &catalog = getCatalog();
+    if (catalog.mNames.empty())
+    {
+        std::cerr << "Object not found in database" << std::endl;
+        return objects;
+    }
+
+    std::vector<int> rows(static_cast<size_t>(aCount));
+    RandomGenerator randomEngine;
+    randomEngine.fillRandomValues(rows.data(), rows.size(), 0, static_cast<int>(catalog.mNames.size()) - 1);
+    for (int row : rows)
+    {
+        GameObject *object = createFromCatalog(catalog, static_cast<size_t>(row));
+        if (object != nullptr)
+        {
+            objects.push_back(Sean::Object<GameObject>(object));
+        }
+    }
+    return objects;
+}
+
+/**
+ * @brief Creates a GameObject for each of the specified names from the catalog of the Objecten table.
+ *
+ * @param aNames The names of the objects to create.
+ * @return Sean::Vector<Sean::Object<GameObject>> The created objects in the order of the names, without the objects that were not found.
+ */
+Sean::Vector<Sean::Object<GameObject>> GameObjectFactory::createGameObjects(const Sean::Vector<Sean::String> &aNames)
+{
+    Sean::Vector<Sean::Object<GameObject>> objects;
+    if (aNames.empty())
+    {
+        return objects;
+    }
+
+    const Catalog &catalog = getCatalog();
+    for (size_t i = 0; i < aNames.size(); ++i)
+    {
+        size_t row = catalog.mRows.find(aNames[i]);
+        GameObject *object = row == NameIndex::NoRow ? nullptr : createFromCatalog(catalog, row);
+        if (object == nullptr)
+        {
+            std::cerr << "Object not found: " << aNames[i] << std::endl;
+            continue;
+        }
+        objects.push_back(Sean::Object<GameObject>(object));
+    }
+    return objects;
+}
+
+/**
+ * @brief Creates the value of an object for each of the specified names from the catalog of the Objecten table.
+ *
+ * Values need no allocation of their own, this is how rooms and loot get their objects.
+ *
+ * @param aNames The names of the objects to create.
+ * @return std::vector<ObjectValue> The values in the order of the names, without the objects that were not found.
+ */
+std::vector<ObjectValue> GameObjectFactory::createObjectValues(const Sean::Vector<Sean::String> &aNames)
+{
+    std::vector<ObjectValue> values;
+    if (aNames.empty())
+    {
+        return values;
+    }
+
+    const Catalog &catalog = getCatalog();
+    values.reserve(aNames.size());
+    for (size_t i = 0; i < aNames.size(); ++i)
+    {
+        size_t row = catalog.mRows.find(aNames[i]);
+        if (row == NameIndex::NoRow || catalog.mTypes[row] == ObjectTypeRegistry::InvalidType)
+        {
+            std::cerr << "Object not found: " << aNames[i] << std::endl;
+            continue;
+        }
+        incrementCounter();
+        values.emplace_back(catalog.mTemplates[row], mCounter);
+    }
+    return values;
+}
+
 /**
  * @brief Resets the counter for assigning unique IDs to game objects.
  */
@@ -125,6 +172,107 @@ void GameObjectFactory::resetCounter()
     mCounter = 0;
 }
 
+/**
+ * @brief Raises the counter so new game objects get IDs above an ID that is already in use.
+ *
+ * @param aMinimum The ID in use.
+ */
+void GameObjectFactory::raiseCounter(int aMinimum)
+{
+    mCounter = std::max(mCounter, aMinimum);
+}
+
+/**
+ * @brief Gets the catalog of the Objecten table, reading the table the first time.
+ *
+ * The database does not change while the game runs, so the table is read and indexed once and
+ * every batch afterwards creates its objects from the same catalog.
+ *
+ * @return const Catalog& The catalog, empty if the database has no objects.
+ * @throws std::runtime_error if the database could not be read.
+ */
+const GameObjectFactory::Catalog &GameObjectFactory::getCatalog()
+{
+    static const Catalog catalog = loadCatalog();
+    return catalog;
+}
+
+/**
+ * @brief Reads all rows of the Objecten table and indexes them by name.
+ *
+ * @return Catalog The catalog, empty if the database has no objects.
+ * @throws std::runtime_error if the database could not be read.
+ */
+GameObjectFactory::Catalog GameObjectFactory::loadCatalog()
+{
+    Catalog catalog;
+    Sean::Vector<Sean::String> descriptions;
+    Sean::Vector<Sean::String> types;
+    Sean::Vector<int> minValues;
+    Sean::Vector<int> maxValues;
+    Sean::Vector<int> protections;
+    try
+    {
+        SQLReader::getInstance().getAllObjects(catalog.mNames, descriptions, types, minValues, maxValues, protections);
+    }
+    catch (std::exception &e)
+    {
+        throw std::runtime_error(e.what());
+    }
+
+    // Types and templates are resolved here once, creating an object from a row only copies them
+    ObjectTypeRegistry &registry = ObjectTypeRegistry::getInstance();
+    for (size_t i = 0; i < catalog.mNames.size(); ++i)
+    {
+        uint32_t type = registry.find(types[i]);
+        catalog.mTypes.push_back(type);
+        catalog.mTemplates.push_back(type == ObjectTypeRegistry::InvalidType ? ObjectTemplates::EmptyTemplate : registry.internTemplate(type, catalog.mNames[i], descriptions[i], minValues[i], maxValues[i], protections[i]));
+    }
+
+    catalog.mRows = NameIndex(catalog.mNames);
+    return catalog;
+}
+
+/**
+ * @brief Creates a GameObject from a row of a catalog.
+ *
+ * @param aCatalog The catalog.
+ * @param aRow The index of the row.
+ * @return GameObject* The created object, or nullptr if its type is not registered.
+ */
+GameObject *GameObjectFactory::createFromCatalog(const Catalog &aCatalog, size_t aRow)
+{
+    if (aCatalog.mTypes[aRow] == ObjectTypeRegistry::InvalidType)
+    {
+        return nullptr;
+    }
+    incrementCounter();
+    return ObjectTypeRegistry::getInstance().create(aCatalog.mTypes[aRow], aCatalog.mTemplates[aRow], mCounter);
+}
+
+/**
+ * @brief Creates a GameObject from a row of the Objecten table, dispatching on its type through the ObjectTypeRegistry.
+ *
+ * @param aName The name of the object.
+ * @param aDescription The description of the object.
+ * @param aType The name of the type of the object.
+ * @param aMinValue The minimum value of the object.
+ * @param aMaxValue The maximum value of the object.
+ * @param aProtection The protection of the object.
+ * @return GameObject* The created object, or nullptr if the type is not registered.
+ */
+GameObject *GameObjectFactory::createFromRow(const Sean::String &aName, const Sean::String &aDescription, const Sean::String &aType, int aMinValue, int aMaxValue, int aProtection)
+{
+    ObjectTypeRegistry &registry = ObjectTypeRegistry::getInstance();
+    uint32_t type = registry.find(aType);
+    if (type == ObjectTypeRegistry::InvalidType)
+    {
+        return nullptr;
+    }
+    incrementCounter();
+    return registry.create(type, aName, aDescription, aMinValue, aMaxValue, aProtection, mCounter);
+}
+
 /**
  * @brief Increments the counter for assigning unique IDs to game objects.
  */
@@ -1,5 +1,4 @@
 #include "GoldObject.h"
-#include "RandomGenerator.h"
 #include <iostream>
 
 // Constructors
@@ -15,7 +14,17 @@
  * @param aID The ID of the gold object.
  */
 GoldObject::GoldObject(const Sean::String aName, const Sean::String aDescription, int aMinimumValue, int aMaximumValue, ObjectType aType, int aID)
-    : GameObject(aName, aDescription, aType, aID), mMinimumValue(aMinimumValue), mMaximumValue(aMaximumValue)
+    : GameObject(aName, aDescription, aType, aMinimumValue, aMaximumValue, aID)
+{
+}
+
+/**
+ * @brief Constructs a gold object that wraps an object value.
+ * 
+ * @param aValue The value of the object.
+ */
+GoldObject::GoldObject(const ObjectValue &aValue)
+    : GameObject(aValue)
 {
 }
 
@@ -25,7 +34,7 @@ GoldObject::GoldObject(const Sean::String aName, const Sean::String aDescription
  * @param other The GoldObject to copy.
  */
 GoldObject::GoldObject(const GoldObject &other)
-    : GameObject(other), mMinimumValue(other.mMinimumValue), mMaximumValue(other.mMaximumValue)
+    : GameObject(other)
 {
 }
 
@@ -35,10 +44,8 @@ GoldObject::GoldObject(const GoldObject &other)
  * @param other The GoldObject to move.
  */
 GoldObject::GoldObject(GoldObject &&other) noexcept
-    : GameObject(std::move(other)), mMinimumValue(other.mMinimumValue), mMaximumValue(other.mMaximumValue)
+    : GameObject(std::move(other))
 {
-    other.mMinimumValue = 0;
-    other.mMaximumValue = 0;
 }
 
 // Assignment Operators
@@ -54,8 +61,6 @@ GoldObject &GoldObject::operator=(const GoldObject &other)
     if (this != &other)
     {
         GameObject::operator=(other);
-        mMinimumValue = other.mMinimumValue;
-        mMaximumValue = other.mMaximumValue;
     }
     return *this;
 }
@@ -71,11 +76,6 @@ GoldObject &GoldObject::operator=(GoldObject &&other) noexcept
     if (this != &other)
     {
         GameObject::operator=(std::move(other));
-        mMinimumValue = other.mMinimumValue;
-        mMaximumValue = other.mMaximumValue;
-
-        other.mMinimumValue = 0;
-        other.mMaximumValue = 0;
     }
     return *this;
 }
@@ -97,8 +97,7 @@ IGameObject *GoldObject::clone() const
  */
 void GoldObject::printDescription() const
 {
-    std::cout << mDescription << std::endl;
-    std::cout << "Bevat tussen " << mMinimumValue << " - " << mMaximumValue << " goudstukken" << std::endl;
+    mValue.printDescription();
 }
 
 /**
@@ -108,8 +107,7 @@ void GoldObject::printDescription() const
  */
 int GoldObject::getValue() const
 {
-    RandomGenerator randomEngine;
-    return randomEngine.getRandomValue(mMinimumValue, mMaximumValue);
+    return mValue.getValue();
 }
 
 /**
@@ -119,7 +117,7 @@ int GoldObject::getValue() const
  */
 int GoldObject::getMin() const
 {
-    return mMinimumValue;
+    return mValue.getMin();
 }
 
 /**
@@ -129,5 +127,5 @@ int GoldObject::getMin() const
  */
 int GoldObject::getMax() const
 {
-    return mMaximumValue;
+    return mValue.getMax();
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Location.h"
+#include "ObjectPool.h"
 #include <iostream>
 
 /**
@@ -9,126 +10,60 @@
  * @param aID The ID of the location.
  */
 Location::Location(const Sean::String aName, const Sean::String aDescription, int aID)
-    : mName(aName), mDescription(aDescription), mNorth(nullptr), mEast(nullptr), mSouth(nullptr), mWest(nullptr), mID(aID)
+    : mName(aName), mDescription(aDescription), mID(aID)
 {
 }
 
 /**
- * @brief Gets the name of the location.
+ * @brief Allocates the memory for a location from the Location pool.
  * 
- * @return The name of the location.
+ * @param aSize The size of the object.
+ * @return void* The memory.
  */
-Sean::String Location::getName() const
+void *Location::operator new(std::size_t aSize)
 {
-    return mName + std::to_string(mID).c_str();
+    return ObjectPool<Location>::allocate(aSize);
 }
 
 /**
- * @brief Adds a visible object to the location.
+ * @brief Returns the memory of a location to the Location pool.
  * 
- * @param aObject The object to add.
+ * @param aObject The memory of the object.
+ * @param aSize The size of the object.
  */
-void Location::addVisibleObject(GameObject *aObject)
+void Location::operator delete(void *aObject, std::size_t aSize)
 {
-    mVisibleObjects.push_back(Sean::Object<GameObject>(std::move(aObject)));
+    ObjectPool<Location>::deallocate(aObject, aSize);
 }
 
 /**
- * @brief Adds a hidden object to the location.
- * 
- * @param aObject The object to add.
- */
-void Location::addHiddenObject(GameObject *aObject)
-{
-    mHiddenObjects.push_back(Sean::Object<GameObject>(std::move(aObject)));
-}
-
-/**
- * @brief Adds an enemy to the location.
- * 
- * @param aEnemy The enemy to add.
- */
-void Location::addEnemy(Enemy aEnemy)
-{
-    mEnemies.push_back(aEnemy);
-}
-
-/**
- * @brief Removes an enemy from the location by name.
+ * @brief Gets the name of the location.
  * 
- * @param aEnemyName The name of the enemy to remove.
+ * @return The name of the location.
  */
-void Location::removeEnemy(const char *aEnemyName)
+Sean::String Location::getName() const
 {
-    for (auto iter = mEnemies.begin(); iter != mEnemies.end(); ++iter)
-    {
-        if (iter->getName() == aEnemyName)
-        {
-            mEnemies.erase(iter);
-            return;
-        }
-    }
+    return mName + std::to_string(mID).c_str();
 }
 
 /**
- * @brief Sets an exit for the location.
+ * @brief Adds a visible object to the location.
  * 
- * @param aDirection The direction of the exit.
- * @param aLocation The location to set as the exit.
+ * @param aObject The value of the object to add.
  */
-void Location::setExit(Sean::Direction aDirection, Location *aLocation)
+void Location::addVisibleObject(const ObjectValue &aObject)
 {
-    if (aLocation == nullptr)
-    {
-        return;
-    }
-    switch (aDirection)
-    {
-    case Sean::Direction::North:
-        mNorth = aLocation;
-        break;
-    case Sean::Direction::East:
-        mEast = aLocation;
-        break;
-    case Sean::Direction::South:
-        mSouth = aLocation;
-        break;
-    case Sean::Direction::West:
-        mWest = aLocation;
-        break;
-    }
+    mVisibleObjects.push_back(aObject);
 }
 
 /**
- * @brief Gets the exit location in a given direction.
- * 
- * @param aDirection The direction of the exit.
- * @return The exit location.
- */
-Location *Location::getExit(Sean::Direction aDirection) const
-{
-    switch (aDirection)
-    {
-    case Sean::Direction::North:
-        return mNorth;
-    case Sean::Direction::East:
-        return mEast;
-    case Sean::Direction::South:
-        return mSouth;
-    case Sean::Direction::West:
-        return mWest;
-    }
-    return nullptr;
-}
-
-/**
- * @brief Gets the enemies in the location.
+ * @brief Adds a hidden object to the location.
  * 
- * @return A reference to the vector of enemies.
+ * @param aObject The value of the object to add.
  */
-Sean::Vector<Enemy> &Location::getEnemies()
+void Location::addHiddenObject(const ObjectValue &aObject)
 {
-    return mEnemies;
+    mHiddenObjects.push_back(aObject);
 }
 
 /**
@@ -153,58 +88,21 @@ void Location::printDescriptionLong() const
     }
     else
     {
-        for (const Sean::Object<GameObject> &obj : mVisibleObjects)
-        {
-            std::cout << "\t" << obj.get()->getName() << std::endl;
-        }
-    }
-    std::cout << "Vijanden:" << std::endl;
-    if (mEnemies.empty())
-    {
-        std::cout << "\tgeen" << std::endl;
-    }
-    else
-    {
-        for (const auto &enemy : mEnemies)
+        for (const ObjectValue &obj : mVisibleObjects)
         {
-            std::cout << "\t" << enemy.getName() << std::endl;
+            std::cout << "\t" << obj.getName() << std::endl;
         }
     }
 }
 
-/**
- * @brief Prints the exits of the location.
- */
-void Location::printExits() const
-{
-    std::cout << "Uitgangen: ";
-    if (mNorth != nullptr)
-    {
-        std::cout << "noord ";
-    }
-    if (mEast != nullptr)
-    {
-        std::cout << "oost ";
-    }
-    if (mSouth != nullptr)
-    {
-        std::cout << "zuid ";
-    }
-    if (mWest != nullptr)
-    {
-        std::cout << "west ";
-    }
-    std::cout << std::endl;
-}
-
 /**
  * @brief Moves hidden objects to visible objects.
  */
 void Location::moveHiddenObjects()
 {
-    for (Sean::Object<GameObject> &obj : mHiddenObjects)
+    for (const ObjectValue &obj : mHiddenObjects)
     {
-        mVisibleObjects.push_back(std::move(obj));
+        mVisibleObjects.push_back(obj);
     }
     mHiddenObjects.clear();
 }
@@ -213,64 +111,41 @@ void Location::moveHiddenObjects()
  * @brief Picks up an object from the location by name.
  * 
  * @param aObjectName The name of the object to pick up.
- * @return The picked up object.
+ * @param aObject Set to the value of the picked up object.
+ * @return True if the object was found and picked up, false otherwise.
  */
-GameObject *Location::pickUpObject(const char *aObjectName)
+bool Location::pickUpObject(const char *aObjectName, ObjectValue &aObject)
 {
     for (auto iter = mVisibleObjects.begin(); iter != mVisibleObjects.end(); ++iter)
     {
-        if (iter->get()->getName() == aObjectName)
+        if (iter->getName() == aObjectName)
         {
-            Sean::Object<GameObject> obj = std::move(*iter);
+            aObject = *iter;
             mVisibleObjects.erase(iter);
-            return obj.release();
+            return true;
         }
     }
-    return nullptr;
+    return false;
 }
 
 /**
- * @brief Prints the details of an object or enemy by name.
+ * @brief Prints the details of a visible object by name.
  * 
- * @param aObjectName The name of the object or enemy to print.
- * @return True if the object or enemy was found and printed, false otherwise.
+ * @param aObjectName The name of the object to print.
+ * @return True if the object was found and printed, false otherwise.
  */
 bool Location::printObject(const char *aObjectName)
 {
-    for (const Sean::Object<GameObject> &obj : mVisibleObjects)
+    for (const ObjectValue &obj : mVisibleObjects)
     {
-        if (obj->getName() == aObjectName)
+        if (obj.getName() == aObjectName)
         {
-            obj->printName();
-            obj->printDescription();
+            obj.printName();
+            obj.printDescription();
             return true;
         }
     }
 
-    for (Enemy &obj : mEnemies)
-    {
-        if (obj.getName() == aObjectName)
-        {
-            if (obj.isDead())
-            {
-                obj.printName();
-                obj.printDescription();
-                for (auto &hiddenObj : obj.getHiddenObjects())
-                {
-                    mVisibleObjects.push_back(Sean::Object(hiddenObj.release()));
-                }
-                obj.getHiddenObjects().clear();
-                
-                return true;
-            }
-            else
-            {
-                obj.printName();
-                obj.printDescription();
-                return true;
-            }
-        }
-    }
     return false;
 }
 
@@ -279,7 +154,7 @@ bool Location::printObject(const char *aObjectName)
  * 
  * @return A reference to the vector of visible objects.
  */
-const Sean::Vector<Sean::Object<GameObject>> &Location::getVisibleObjects() const
+const Sean::Vector<ObjectValue> &Location::getVisibleObjects() const
 {
     return mVisibleObjects;
 }
@@ -289,17 +164,7 @@ const Sean::Vector<Sean::Object<GameObject>> &Location::getVisibleObjects() cons
  * 
  * @return A reference to the vector of hidden objects.
  */
-const Sean::Vector<Sean::Object<GameObject>> &Location::getHiddenObjects() const
+const Sean::Vector<ObjectValue> &Location::getHiddenObjects() const
 {
     return mHiddenObjects;
-}
-
-/**
- * @brief Gets the enemies in the location.
- * 
- * @return A reference to the vector of enemies.
- */
-const Sean::Vector<Enemy> &Location::getEnemies() const
-{
-    return mEnemies;
 }
\ No newline at end of file
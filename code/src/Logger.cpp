@@ -1,4 +1,7 @@
 #include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <filesystem>
 
 namespace Sean
@@ -10,23 +13,21 @@ namespace Sean
      * @brief Constructor: Initializes the logger with a custom stream buffer.
      */
     Logger::Logger()
-        : mLogFile(),                                  // Initialize the log file
-          mLoggerBufCout(std::cout.rdbuf(), mLogFile), // Initialize the custom stream buffer cout with console and file buffers
-          mLoggerBufCin(std::cin.rdbuf(), mLogFile),   // Initialize the custom stream buffer cin with console and file buffers
-          mOriginalCoutBuf(std::cout.rdbuf()),         // Save the original cout buffer with unique_ptr
-          mOriginalCinBuf(std::cin.rdbuf())            // Save the original cin buffer with unique_ptr
+        : mWriter(),                                  // Initialize the log file writer
+          mLoggerBufCout(std::cout.rdbuf(), mWriter), // Initialize the custom stream buffer cout with console and file buffers
+          mLoggerBufCin(std::cin.rdbuf(), mWriter),   // Initialize the custom stream buffer cin with console and file buffers
+          mOriginalCoutBuf(std::cout.rdbuf()),        // Save the original cout buffer with unique_ptr
+          mOriginalCinBuf(std::cin.rdbuf())           // Save the original cin buffer with unique_ptr
     {
     }
 
     /**
-     * @brief Destructor: Closes the log file and restores the original buffers.
+     * @brief Destructor: Writes the remaining output, closes the log file and restores the original buffers.
      */
     Logger::~Logger()
     {
-        if (mLogFile.is_open())
-        {
-            mLogFile.close();
-        }
+        mLoggerBufCout.pubsync();
+        mWriter.close();
 
         // Restore the original std::cout and std::cin buffers
         std::cout.rdbuf(mOriginalCoutBuf);
@@ -48,14 +49,12 @@ namespace Sean
     }
 
     /**
-     * @brief Create and open a log file with the current date and time in its name.
+     * @brief Get the folder the log files are written to, creating it if needed.
+     * @return The path of the folder.
+     * @throws std::runtime_error if the folder cannot be created.
      */
-    void Logger::createLogFile()
+    std::string Logger::getLogFolder()
     {
-        if (instance.mLogFile.is_open())
-        {
-            instance.mLogFile.close();
-        }
         std::string folderPath = "../../../log";
 
         // Ensure the folder exists
@@ -63,62 +62,301 @@ namespace Sean
         {
             throw std::runtime_error("Failed to create log directory: " + folderPath);
         }
+        return folderPath;
+    }
+
+    /**
+     * @brief Create and open a log file with the current date and time in its name.
+     */
+    void Logger::createLogFile()
+    {
+        instance.mLoggerBufCout.pubsync();
+        instance.mWriter.close();
+        std::string fileName = getLogFolder() + "/GameLog_" + getCurrentDateTime() + ".log";
+        instance.mWriter.open(fileName);
+    }
+
+    /**
+     * @brief Write all output so far to the console and the log file and wait until it is on disk.
+     */
+    void Logger::flush()
+    {
+        instance.mLoggerBufCout.pubsync();
+        instance.mWriter.flush();
+    }
+
+    /**
+     * @brief LogWriter constructor: Initializes an empty ring buffer without a log file.
+     */
+    Logger::LogWriter::LogWriter()
+        : mRing(Capacity), mHead(0), mTail(0), mRequests(0), mStop(false), mFlushed(0)
+    {
+    }
+
+    /**
+     * @brief LogWriter destructor: Writes the remaining data and closes the log file.
+     */
+    Logger::LogWriter::~LogWriter()
+    {
+        close();
+    }
+
+    /**
+     * @brief Open a log file and start the writer thread.
+     * @param aFileName The path of the log file, appended to if it exists.
+     * @throws std::runtime_error if the log file cannot be opened.
+     */
+    void Logger::LogWriter::open(const std::string &aFileName)
+    {
+        mFile.open(aFileName, std::ios_base::out | std::ios_base::app);
+        if (!mFile.is_open())
+        {
+            throw std::runtime_error("Failed to open log file: " + aFileName);
+        }
+        mFlushed = mRequests.load();
+        mThread = std::thread(&LogWriter::run, this);
+    }
 
-        std::string fileName = folderPath + "/GameLog_" + getCurrentDateTime() + ".log";
-        instance.mLogFile.open(fileName, std::ios_base::out | std::ios_base::app);
+    /**
+     * @brief Stop the writer thread once it has written all data and close the log file.
+     */
+    void Logger::LogWriter::close()
+    {
+        if (!mThread.joinable())
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop.store(true);
+        }
+        mWake.notify_one();
+        mThread.join();
+        mStop.store(false);
+        mFile.close();
+    }
 
-        if (!instance.mLogFile.is_open())
+    /**
+     * @brief Put data into the ring buffer, only called from the game thread.
+     *
+     * Data written while no log file is open is dropped. When the ring is full the game thread
+     * wakes the writer thread and waits for it to make room.
+     *
+     * @param aData The data to write.
+     * @param aSize The number of bytes.
+     */
+    void Logger::LogWriter::write(const char *aData, size_t aSize)
+    {
+        if (!mThread.joinable())
+        {
+            return;
+        }
+        while (aSize > 0)
+        {
+            size_t head = mHead.load(std::memory_order_acquire);
+            size_t tail = mTail.load(std::memory_order_relaxed);
+            size_t space = Capacity - (tail - head);
+            if (space == 0)
+            {
+                mWake.notify_one();
+                std::this_thread::yield();
+                continue;
+            }
+
+            size_t count = std::min(aSize, space);
+            size_t start = tail & (Capacity - 1);
+            size_t first = std::min(count, Capacity - start);
+            memcpy(mRing.data() + start, aData, first);
+            memcpy(mRing.data(), aData + first, count - first);
+            mTail.store(tail + count, std::memory_order_release);
+            aData += count;
+            aSize -= count;
+
+            if (tail + count - head > Capacity / 2)
+            {
+                mWake.notify_one();
+            }
+        }
+    }
+
+    /**
+     * @brief Wait until the writer thread has written all data so far and flushed the log file.
+     */
+    void Logger::LogWriter::flush()
+    {
+        if (!mThread.joinable())
         {
-            throw std::runtime_error("Failed to open log file: " + fileName);
+            return;
         }
+        uint64_t request = mRequests.fetch_add(1) + 1;
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWake.notify_one();
+        mFlushDone.wait(lock, [&]()
+                        { return mFlushed >= request; });
+    }
+
+    /**
+     * @brief Body of the writer thread: write the ring buffer to the log file until stopped.
+     */
+    void Logger::LogWriter::run()
+    {
+        uint64_t flushed = mFlushed;
+        while (true)
+        {
+            // Read the flush requests before the tail, so a flush covers all data written before it
+            uint64_t requests = mRequests.load(std::memory_order_acquire);
+            size_t head = mHead.load(std::memory_order_relaxed);
+            size_t tail = mTail.load(std::memory_order_acquire);
+            if (head != tail)
+            {
+                size_t start = head & (Capacity - 1);
+                size_t count = std::min(tail - head, Capacity - start);
+                mFile.write(mRing.data() + start, count);
+                mHead.store(head + count, std::memory_order_release);
+                continue;
+            }
+            if (requests != flushed)
+            {
+                mFile.flush();
+                flushed = requests;
+                std::lock_guard<std::mutex> lock(mMutex);
+                mFlushed = requests;
+                mFlushDone.notify_all();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mMutex);
+            if (mStop.load())
+            {
+                break;
+            }
+            mWake.wait_for(lock, std::chrono::milliseconds(WriteInterval), [&]()
+                           { return mStop.load() || mTail.load(std::memory_order_acquire) != tail || mRequests.load() != flushed; });
+        }
+        mFile.flush();
     }
 
     /**
      * @brief Constructor: Initializes the custom stream buffer with console and file buffers.
      * @param aConsoleBufCout The original console buffer.
-     * @param aFileStream The log file stream.
+     * @param aWriter The writer of the log file.
      */
-    Logger::LoggerBufCout::LoggerBufCout(std::streambuf *aConsoleBufCout, std::ofstream &aFileStream)
-        : mConsoleBufCout(aConsoleBufCout), mFileStream(aFileStream) {}
+    Logger::LoggerBufCout::LoggerBufCout(std::streambuf *aConsoleBufCout, LogWriter &aWriter)
+        : mConsoleBufCout(aConsoleBufCout), mWriter(aWriter)
+    {
+        setp(mBuffer, mBuffer + BufferSize);
+    }
 
     /**
-     * @brief Write a character to both the console and the log file.
+     * @brief Hand the full put area on and store a character in the emptied put area.
      * @param c The character to write.
      * @return The character written, or EOF on failure.
      */
     int Logger::LoggerBufCout::overflow(int c)
     {
+        bool const written = drain();
         if (c == EOF)
         {
-            return !EOF;
+            return written ? !EOF : EOF;
         }
-        else
+        *pptr() = static_cast<char>(c);
+        pbump(1);
+        return written ? c : EOF;
+    }
+
+    /**
+     * @brief Write a block of characters, copying it into the put area when it fits.
+     * @param s The characters to write.
+     * @param n The number of characters.
+     * @return The number of characters written.
+     */
+    std::streamsize Logger::LoggerBufCout::xsputn(const char *s, std::streamsize n)
+    {
+        if (n > epptr() - pptr())
         {
-            int const r1 = mConsoleBufCout->sputc(c);     // Write to console
-            int const r2 = mFileStream.rdbuf()->sputc(c); // Write to file buffer
-            return r1 == EOF || r2 == EOF ? EOF : c;      // Return EOF if either write failed
+            if (!drain())
+            {
+                return 0;
+            }
+            if (n >= static_cast<std::streamsize>(BufferSize))
+            {
+                return write(s, static_cast<size_t>(n)) ? n : 0; // Too large to buffer, hand it on directly
+            }
         }
+        memcpy(pptr(), s, static_cast<size_t>(n));
+        pbump(static_cast<int>(n));
+        return n;
     }
 
     /**
-     * @brief Synchronize the console and file buffers.
+     * @brief Hand the put area to the console and the log file and flush the console.
      * @return 0 on success, -1 on failure.
      */
     int Logger::LoggerBufCout::sync()
     {
-        int const r1 = mConsoleBufCout->pubsync();     // Flush console buffer to the console
-        int const r2 = mFileStream.rdbuf()->pubsync(); // Flush file buffer to the file
-        return r1 == 0 && r2 == 0 ? 0 : -1;
+        bool const r1 = drain();                                                    // Hand the buffered output on
+        int const r2 = mConsoleBufCout != nullptr ? mConsoleBufCout->pubsync() : 0; // Flush console buffer to the console
+        return r1 && r2 == 0 ? 0 : -1;
+    }
+
+    /**
+     * @brief Hand the characters in the put area to the console and the log file and empty it.
+     * @return True on success, false if the console did not take all characters.
+     */
+    bool Logger::LoggerBufCout::drain()
+    {
+        size_t const size = static_cast<size_t>(pptr() - pbase());
+        setp(mBuffer, mBuffer + BufferSize);
+        return size == 0 || write(mBuffer, size);
+    }
+
+    /**
+     * @brief Write characters to the console and the log file.
+     * @param aData The characters to write.
+     * @param aSize The number of characters.
+     * @return True on success, false if the console did not take all characters.
+     */
+    bool Logger::LoggerBufCout::write(const char *aData, size_t aSize)
+    {
+        mWriter.write(aData, aSize); // Hand to the log file writer
+        if (mConsoleBufCout == nullptr)
+        {
+            return true;
+        }
+        return mConsoleBufCout->sputn(aData, static_cast<std::streamsize>(aSize)) == static_cast<std::streamsize>(aSize); // Write to console
+    }
+
+    /**
+     * @brief Set the console buffer the output is written to.
+     * @param aConsoleBufCout The console buffer, nullptr to write to the log file only.
+     */
+    void Logger::LoggerBufCout::setConsoleBuf(std::streambuf *aConsoleBufCout)
+    {
+        drain();
+        mConsoleBufCout = aConsoleBufCout;
+    }
+
+    /**
+     * @brief Get the console buffer the output is written to.
+     * @return The console buffer, or nullptr if the output only goes to the log file.
+     */
+    std::streambuf *Logger::LoggerBufCout::getConsoleBuf() const
+    {
+        return mConsoleBufCout;
     }
 
     /**
      * @brief LoggerBufCin constructor: Initializes with cin and file buffers.
      */
-    Logger::LoggerBufCin::LoggerBufCin(std::streambuf *aCinBuf, std::ofstream &aFileStream)
-        : mCinBuf(aCinBuf), mFileStream(aFileStream) {}
+    Logger::LoggerBufCin::LoggerBufCin(std::streambuf *aCinBuf, LogWriter &aWriter)
+        : mCinBuf(aCinBuf), mWriter(aWriter) {}
 
     /**
      * @brief LoggerBufCin uflow: Get a character from cin and log it to the file.
+     *
+     * std::cin is tied to std::cout, so the output before the input is already handed on and the
+     * input lands after it in the log.
+     *
      * @return The character read from cin.
      */
     int Logger::LoggerBufCin::uflow()
@@ -126,8 +364,8 @@ namespace Sean
         int ch = mCinBuf->sbumpc(); // Get a character from std::cin
         if (ch != EOF)
         {
-            mFileStream.put(static_cast<char>(ch)); // Log the character to the file
-            mFileStream.flush();
+            char const c = static_cast<char>(ch);
+            mWriter.write(&c, 1); // Log the character to the file
         }
         return ch;
     }
@@ -141,6 +379,15 @@ namespace Sean
         return mCinBuf->sgetc(); // Peek the next character from std::cin
     }
 
+    /**
+     * @brief LoggerBufCin setCinBuf: Set the buffer the input is read from.
+     * @param aCinBuf The input buffer.
+     */
+    void Logger::LoggerBufCin::setCinBuf(std::streambuf *aCinBuf)
+    {
+        mCinBuf = aCinBuf;
+    }
+
     /**
      * @brief Replace std::cout with the custom logger buffer.
      */
@@ -168,4 +415,31 @@ namespace Sean
         return instance.mOriginalCinBuf;
     }
 
-} // namespace Sean
+    /**
+     * @brief Enable or disable the console output, the log file keeps receiving everything.
+     * @param aEnabled True to write to the original std::cout buffer, false to run headless.
+     */
+    void Logger::setConsoleOutput(bool aEnabled)
+    {
+        instance.mLoggerBufCout.setConsoleBuf(aEnabled ? instance.mOriginalCoutBuf : nullptr);
+    }
+
+    /**
+     * @brief Check whether the output is written to the console.
+     * @return True if the output is written to the console, false if it only goes to the log file.
+     */
+    bool Logger::hasConsoleOutput()
+    {
+        return instance.mLoggerBufCout.getConsoleBuf() != nullptr;
+    }
+
+    /**
+     * @brief Set the buffer the input is read from, such as a recorded session.
+     * @param aInputBuf The input buffer, nullptr to read from the original std::cin buffer again.
+     */
+    void Logger::setInputBuf(std::streambuf *aInputBuf)
+    {
+        instance.mLoggerBufCin.setCinBuf(aInputBuf != nullptr ? aInputBuf : instance.mOriginalCinBuf);
+    }
+
+} // namespace Sean
\ No newline at end of file
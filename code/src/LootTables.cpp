@@ -0,0 +1,112 @@
+#include "LootTables.h"
+#include "GameObjectFactory.h"
+#include "RandomStream.h"
+#include "SqlReader.h"
+
+#include <stdexcept>
+
+/**
+ * @brief Constructs the store with only the table of enemies that drop nothing.
+ */
+LootTables::LootTables()
+{
+    mTables.push_back({0, 0});
+}
+
+/**
+ * @brief Gets the singleton instance of LootTables.
+ *
+ * @return LootTables& Reference to the singleton instance of LootTables.
+ */
+LootTables &LootTables::getInstance()
+{
+    static LootTables instance;
+    return instance;
+}
+
+/**
+ * @brief Gets the loot table of a kind of enemy, reading it from the database the first time.
+ *
+ * @param aEnemyName The name of the enemy, without its ID.
+ * @return uint32_t The index of the table, or NoLoot if the enemy drops nothing.
+ */
+uint32_t LootTables::find(const Sean::String &aEnemyName)
+{
+    std::string key(aEnemyName.c_str());
+    auto existing = mLookup.find(key);
+    if (existing != mLookup.end())
+    {
+        return existing->second;
+    }
+
+    int minimum;
+    int maximum;
+    uint32_t table = NoLoot;
+    if (SQLReader::getInstance().getObjectAmount(aEnemyName, minimum, maximum) && maximum > 0)
+    {
+        table = static_cast<uint32_t>(mTables.size());
+        mTables.push_back({minimum, maximum});
+    }
+    mLookup.emplace(std::move(key), table);
+    return table;
+}
+
+/**
+ * @brief Gets a loot table.
+ *
+ * @param aTable The index of the table.
+ * @return const Table& The table.
+ * @throws std::out_of_range if the index is invalid.
+ */
+const LootTables::Table &LootTables::get(uint32_t aTable) const
+{
+    if (aTable >= mTables.size())
+    {
+        throw std::out_of_range("Invalid loot table");
+    }
+    return mTables[aTable];
+}
+
+/**
+ * @brief Rolls the names of the objects an enemy drops.
+ *
+ * @param aTable The index of the loot table.
+ * @param aSeed The loot seed of the enemy.
+ * @return Sean::Vector<Sean::String> The names of the objects, the same for the same table and seed.
+ * @throws std::out_of_range if the table is invalid.
+ */
+Sean::Vector<Sean::String> LootTables::roll(uint32_t aTable, uint32_t aSeed)
+{
+    Sean::Vector<Sean::String> names;
+    const Table &table = get(aTable);
+    if (table.mMaximum <= 0)
+    {
+        return names;
+    }
+    if (mObjectNames.empty() && !SQLReader::getInstance().getAllObjectNames(mObjectNames))
+    {
+        return names;
+    }
+
+    RandomStream random(aSeed, 0, 0);
+    int amount = random.getRandomValue(table.mMinimum, table.mMaximum);
+    int lastObject = static_cast<int>(mObjectNames.size()) - 1;
+    for (int i = 0; i < amount; ++i)
+    {
+        names.push_back(mObjectNames[static_cast<size_t>(random.getRandomValue(0, lastObject))]);
+    }
+    return names;
+}
+
+/**
+ * @brief Creates the objects an enemy drops.
+ *
+ * @param aTable The index of the loot table.
+ * @param aSeed The loot seed of the enemy.
+ * @return std::vector<ObjectValue> The objects.
+ * @throws std::out_of_range if the table is invalid.
+ */
+std::vector<ObjectValue> LootTables::createLoot(uint32_t aTable, uint32_t aSeed)
+{
+    return GameObjectFactory::createObjectValues(roll(aTable, aSeed));
+}
\ No newline at end of file
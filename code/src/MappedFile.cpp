@@ -0,0 +1,67 @@
+#include "MappedFile.h"
+
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Maps a whole file into memory.
+ *
+ * @param aPath The path to the file.
+ * @throws std::runtime_error if the file cannot be opened, is empty or cannot be mapped.
+ */
+MappedFile::MappedFile(const char *aPath)
+    : mData(nullptr), mSize(0)
+{
+    int fd = open(aPath, O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error(std::string("Failed to load file: ") + aPath);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+        close(fd);
+        throw std::runtime_error(std::string("Failed to load file: ") + aPath);
+    }
+    mSize = static_cast<size_t>(info.st_size);
+    void *data = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw std::runtime_error(std::string("Failed to map file: ") + aPath);
+    }
+    mData = static_cast<const char *>(data);
+}
+
+/**
+ * @brief Unmaps the file.
+ */
+MappedFile::~MappedFile()
+{
+    munmap(const_cast<char *>(mData), mSize);
+}
+
+/**
+ * @brief Gets the start of the mapping.
+ *
+ * @return const char* The first byte of the file.
+ */
+const char *MappedFile::getData() const
+{
+    return mData;
+}
+
+/**
+ * @brief Gets the size of the mapping.
+ *
+ * @return size_t The size of the file in bytes.
+ */
+size_t MappedFile::getSize() const
+{
+    return mSize;
+}
\ No newline at end of file
@@ -0,0 +1,253 @@
+#include "MovementScheduler.h"
+#include "RandomGenerator.h"
+#include "RandomStream.h"
+
+#include <algorithm>
+#include <thread>
+
+/**
+ * @brief Constructs a scheduler with a random seed that uses all hardware threads.
+ *
+ * The seed is drawn from the RandomGenerator, so a seeded generator also fixes the movement.
+ */
+MovementScheduler::MovementScheduler()
+    : mSeed(RandomGenerator().next()), mThreadCount(std::max(1u, std::thread::hardware_concurrency()))
+{
+}
+
+/**
+ * @brief Sets the seed of the random streams.
+ *
+ * @param aSeed The seed.
+ */
+void MovementScheduler::setSeed(uint64_t aSeed)
+{
+    mSeed = aSeed;
+}
+
+/**
+ * @brief Gets the seed of the random streams.
+ *
+ * @return uint64_t The seed.
+ */
+uint64_t MovementScheduler::getSeed() const
+{
+    return mSeed;
+}
+
+/**
+ * @brief Sets the maximum number of worker threads used for planning.
+ *
+ * @param aThreads The number of threads, 0 is treated as 1.
+ */
+void MovementScheduler::setThreadCount(unsigned aThreads)
+{
+    mThreadCount = std::max(1u, aThreads);
+}
+
+/**
+ * @brief Plans the moves of all living enemies for one turn.
+ *
+ * Only the current positions are read, nothing is moved yet.
+ *
+ * @param aEntities The enemies to plan for.
+ * @param aGraph The exits between the rooms.
+ * @param aTurn The turn to plan.
+ */
+void MovementScheduler::planMoves(const EntityStore &aEntities, const RoomGraph &aGraph, uint32_t aTurn)
+{
+    mSimulated.resize(aEntities.getEntityCount());
+    for (EntityStore::EntityId entity = 0; entity < mSimulated.size(); ++entity)
+    {
+        mSimulated[entity] = entity;
+    }
+    planSimulated(aEntities, aGraph, aTurn);
+}
+
+/**
+ * @brief Plans the moves of the living enemies in the given rooms for one turn.
+ *
+ * The cost depends on the number of rooms and enemies given, not on the size of the dungeon.
+ *
+ * @param aEntities The enemies to plan for.
+ * @param aGraph The exits between the rooms.
+ * @param aRooms The room indexes to simulate.
+ * @param aTurn The turn to plan.
+ */
+void MovementScheduler::planMoves(const EntityStore &aEntities, const RoomGraph &aGraph, const std::vector<uint32_t> &aRooms, uint32_t aTurn)
+{
+    mSimulated.clear();
+    for (uint32_t room : aRooms)
+    {
+        const std::vector<EntityStore::EntityId> &entities = aEntities.getEntitiesIn(room);
+        mSimulated.insert(mSimulated.end(), entities.begin(), entities.end());
+    }
+    // The order of the rooms must not influence the result
+    std::sort(mSimulated.begin(), mSimulated.end());
+    planSimulated(aEntities, aGraph, aTurn);
+}
+
+/**
+ * @brief Applies the planned moves in one pass.
+ *
+ * @param aEntities The enemies to move.
+ * @param aTurn The turn that was simulated.
+ */
+void MovementScheduler::applyMoves(EntityStore &aEntities, uint32_t aTurn)
+{
+    for (const Move &move : mMoves)
+    {
+        aEntities.setPosition(move.mEntity, move.mRoom);
+    }
+    for (EntityStore::EntityId entity : mSimulated)
+    {
+        aEntities.setLastSimulated(entity, aTurn);
+    }
+    mMoves.clear();
+    mSimulated.clear();
+}
+
+/**
+ * @brief Fast-forwards the enemies in the given rooms that missed turns.
+ *
+ * Missed turns are replayed with the same random streams the regular simulation uses, limited
+ * to the last MaxCatchUpTurns turns. After that many steps the position is spread out enough
+ * that replaying more turns does not change the outcome noticeably.
+ *
+ * @param aEntities The enemies to catch up.
+ * @param aGraph The exits between the rooms.
+ * @param aRooms The room indexes that came into range.
+ * @param aTurn The current turn.
+ */
+void MovementScheduler::catchUp(EntityStore &aEntities, const RoomGraph &aGraph, const std::vector<uint32_t> &aRooms, uint32_t aTurn)
+{
+    // Collect first, catching up moves enemies between the rooms being visited
+    std::vector<EntityStore::EntityId> staleEntities;
+    for (uint32_t room : aRooms)
+    {
+        for (EntityStore::EntityId entity : aEntities.getEntitiesIn(room))
+        {
+            if (aEntities.getLastSimulated(entity) < aTurn)
+            {
+                staleEntities.push_back(entity);
+            }
+        }
+    }
+    std::sort(staleEntities.begin(), staleEntities.end());
+
+    for (EntityStore::EntityId entity : staleEntities)
+    {
+        uint32_t room = aEntities.getPosition(entity);
+        uint32_t turns = std::min(aTurn - aEntities.getLastSimulated(entity), MaxCatchUpTurns);
+        for (uint32_t turn = aTurn - turns + 1; turn <= aTurn; ++turn)
+        {
+            uint32_t target = chooseTarget(aEntities, aGraph, entity, room, turn);
+            if (target != RoomGraph::NoRoom)
+            {
+                room = target;
+            }
+        }
+        aEntities.setPosition(entity, room);
+        aEntities.setLastSimulated(entity, aTurn);
+    }
+}
+
+/**
+ * @brief Gets the moves planned for the current turn.
+ *
+ * @return const std::vector<Move>& The planned moves.
+ */
+const std::vector<MovementScheduler::Move> &MovementScheduler::getPlannedMoves() const
+{
+    return mMoves;
+}
+
+// Private Methods
+
+/**
+ * @brief Plans the moves of the entities in mSimulated, split over worker threads.
+ *
+ * @param aEntities The enemies to plan for.
+ * @param aGraph The exits between the rooms.
+ * @param aTurn The turn to plan.
+ */
+void MovementScheduler::planSimulated(const EntityStore &aEntities, const RoomGraph &aGraph, uint32_t aTurn)
+{
+    mMoves.clear();
+
+    size_t threadCount = std::min<size_t>(mThreadCount, mSimulated.size() / MinEntitiesPerThread);
+    if (threadCount <= 1)
+    {
+        for (EntityStore::EntityId entity : mSimulated)
+        {
+            uint32_t target = chooseTarget(aEntities, aGraph, entity, aEntities.getPosition(entity), aTurn);
+            if (target != RoomGraph::NoRoom)
+            {
+                mMoves.push_back({entity, target});
+            }
+        }
+        return;
+    }
+
+    mThreadMoves.resize(threadCount);
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    size_t chunkSize = (mSimulated.size() + threadCount - 1) / threadCount;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        workers.emplace_back([this, &aEntities, &aGraph, aTurn, i, chunkSize]()
+                             {
+                                 std::vector<Move> &moves = mThreadMoves[i];
+                                 moves.clear();
+                                 size_t end = std::min(mSimulated.size(), (i + 1) * chunkSize);
+                                 for (size_t index = i * chunkSize; index < end; ++index)
+                                 {
+                                     EntityStore::EntityId entity = mSimulated[index];
+                                     uint32_t target = chooseTarget(aEntities, aGraph, entity, aEntities.getPosition(entity), aTurn);
+                                     if (target != RoomGraph::NoRoom)
+                                     {
+                                         moves.push_back({entity, target});
+                                     }
+                                 }
+                             });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    // Merge in chunk order, which is entity order
+    for (const std::vector<Move> &moves : mThreadMoves)
+    {
+        mMoves.insert(mMoves.end(), moves.begin(), moves.end());
+    }
+}
+
+/**
+ * @brief Chooses where an enemy moves to in a turn.
+ *
+ * @param aEntities The enemies.
+ * @param aGraph The exits between the rooms.
+ * @param aEntity The enemy.
+ * @param aRoom The room the enemy is in.
+ * @param aTurn The turn.
+ * @return uint32_t The room index to move to, or RoomGraph::NoRoom if the enemy stays.
+ */
+uint32_t MovementScheduler::chooseTarget(const EntityStore &aEntities, const RoomGraph &aGraph, EntityStore::EntityId aEntity, uint32_t aRoom, uint32_t aTurn) const
+{
+    if (aEntities.isDead(aEntity))
+    {
+        return RoomGraph::NoRoom;
+    }
+    uint32_t exitCount = aGraph.getNeighbourCount(aRoom);
+    if (exitCount == 0)
+    {
+        return RoomGraph::NoRoom;
+    }
+    RandomStream random(mSeed, aEntity, aTurn);
+    if (!random.getChance(MoveChance))
+    {
+        return RoomGraph::NoRoom;
+    }
+    return aGraph.getNeighbours(aRoom)[random.getRandomValue(0, exitCount - 1)];
+}
\ No newline at end of file
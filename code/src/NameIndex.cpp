@@ -0,0 +1,49 @@
+#include "NameIndex.h"
+
+/**
+ * @brief Indexes the names of a column.
+ *
+ * @param aNames The column of names, which has to outlive the index.
+ */
+NameIndex::NameIndex(const Sean::Vector<Sean::String> &aNames)
+{
+    mRows.reserve(aNames.size());
+    for (size_t i = 0; i < aNames.size(); ++i)
+    {
+        mRows.emplace(std::string_view(aNames[i].c_str(), aNames[i].size()), i);
+    }
+}
+
+/**
+ * @brief Finds the row of a name.
+ *
+ * @param aName The name.
+ * @return size_t The row, or NoRow if the name is not in the column.
+ */
+size_t NameIndex::find(std::string_view aName) const
+{
+    auto row = mRows.find(aName);
+    return row != mRows.end() ? row->second : NoRow;
+}
+
+/**
+ * @brief Finds the row of a name.
+ *
+ * @param aName The name.
+ * @return size_t The row, or NoRow if the name is not in the column.
+ */
+size_t NameIndex::find(const Sean::String &aName) const
+{
+    return find(std::string_view(aName.c_str(), aName.size()));
+}
+
+/**
+ * @brief Finds the row of a name.
+ *
+ * @param aName The name.
+ * @return size_t The row, or NoRow if the name is not in the column.
+ */
+size_t NameIndex::find(const char *aName) const
+{
+    return find(std::string_view(aName));
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "NameSampler.h"
+
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Writes a number as a Roman numeral.
+ *
+ * @param aNumber The number, must be greater than zero.
+ * @return std::string The Roman numeral.
+ */
+static std::string toRoman(uint32_t aNumber)
+{
+    static const std::pair<uint32_t, const char *> numerals[] = {
+        {1000, "M"}, {900, "CM"}, {500, "D"}, {400, "CD"}, {100, "C"}, {90, "XC"},
+        {50, "L"}, {40, "XL"}, {10, "X"}, {9, "IX"}, {5, "V"}, {4, "IV"}, {1, "I"}};
+
+    std::string roman;
+    for (const auto &numeral : numerals)
+    {
+        while (aNumber >= numeral.first)
+        {
+            roman += numeral.second;
+            aNumber -= numeral.first;
+        }
+    }
+    return roman;
+}
+
+/**
+ * @brief Constructs a sampler by shuffling the catalog.
+ *
+ * @param aCatalogSize The number of names in the catalog.
+ * @param aRandom The random stream used to shuffle the catalog.
+ * @throws std::invalid_argument if the catalog is empty.
+ */
+NameSampler::NameSampler(size_t aCatalogSize, RandomStream aRandom)
+{
+    if (aCatalogSize == 0)
+    {
+        throw std::invalid_argument("Name catalog must not be empty");
+    }
+
+    mOrder.resize(aCatalogSize);
+    for (size_t i = 0; i < aCatalogSize; ++i)
+    {
+        mOrder[i] = i;
+    }
+    for (size_t i = aCatalogSize - 1; i > 0; --i)
+    {
+        size_t j = static_cast<size_t>(aRandom.next() % (i + 1));
+        std::swap(mOrder[i], mOrder[j]);
+    }
+}
+
+/**
+ * @brief Gets a draw by its number.
+ *
+ * @param aNumber The number of the draw, draws with different numbers never give the same name.
+ * @return Draw The catalog index and variant of the name.
+ */
+NameSampler::Draw NameSampler::draw(size_t aNumber) const
+{
+    return {mOrder[aNumber % mOrder.size()], static_cast<uint32_t>(aNumber / mOrder.size())};
+}
+
+/**
+ * @brief Gets the number of names in the catalog.
+ *
+ * @return size_t The number of names.
+ */
+size_t NameSampler::getCatalogSize() const
+{
+    return mOrder.size();
+}
+
+/**
+ * @brief Gets the name of a variant.
+ *
+ * Variant 0 is the name itself, variant 1 gets "II" appended, variant 2 "III" and so on.
+ * Beyond Roman numerals the variant number is written in digits.
+ *
+ * @param aName The name from the catalog.
+ * @param aVariant The variant of the name.
+ * @return std::string The name of the variant.
+ */
+std::string NameSampler::getVariantName(const char *aName, uint32_t aVariant)
+{
+    const uint32_t maxRoman = 3999;
+    if (aVariant == 0)
+    {
+        return aName;
+    }
+    uint32_t number = aVariant + 1;
+    return std::string(aName) + " " + (number <= maxRoman ? toRoman(number) : std::to_string(number));
+}
\ No newline at end of file
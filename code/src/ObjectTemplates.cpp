@@ -0,0 +1,77 @@
+#include "ObjectTemplates.h"
+
+#include <stdexcept>
+
+/**
+ * @brief Constructs the store with only the empty template.
+ */
+ObjectTemplates::ObjectTemplates()
+{
+    mTemplates.push_back({Sean::String(), Sean::String(), ObjectType::Gold, 0, 0});
+}
+
+/**
+ * @brief Gets the singleton instance of ObjectTemplates.
+ *
+ * @return ObjectTemplates& Reference to the singleton instance of ObjectTemplates.
+ */
+ObjectTemplates &ObjectTemplates::getInstance()
+{
+    static ObjectTemplates instance;
+    return instance;
+}
+
+/**
+ * @brief Gets the template with the given contents, adding it if it does not exist yet.
+ *
+ * @param aName The name of the object, without its ID.
+ * @param aDescription The description of the object.
+ * @param aType The type of the object.
+ * @param aMinimum The minimum value of the object.
+ * @param aMaximum The maximum value of the object.
+ * @return uint32_t The index of the template.
+ */
+uint32_t ObjectTemplates::intern(const Sean::String &aName, const Sean::String &aDescription, ObjectType aType, int aMinimum, int aMaximum)
+{
+    std::string key(aName.c_str());
+    auto range = mLookup.equal_range(key);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        const Template &existing = mTemplates[iter->second];
+        if (existing.mType == aType && existing.mMinimum == aMinimum && existing.mMaximum == aMaximum && existing.mDescription == aDescription)
+        {
+            return iter->second;
+        }
+    }
+
+    uint32_t index = static_cast<uint32_t>(mTemplates.size());
+    mTemplates.push_back({aName, aDescription, aType, aMinimum, aMaximum});
+    mLookup.emplace(std::move(key), index);
+    return index;
+}
+
+/**
+ * @brief Gets a template.
+ *
+ * @param aTemplate The index of the template.
+ * @return const Template& The template.
+ * @throws std::out_of_range if the index is invalid.
+ */
+const ObjectTemplates::Template &ObjectTemplates::get(uint32_t aTemplate) const
+{
+    if (aTemplate >= mTemplates.size())
+    {
+        throw std::out_of_range("Invalid object template");
+    }
+    return mTemplates[aTemplate];
+}
+
+/**
+ * @brief Gets the number of templates, including the empty template.
+ *
+ * @return size_t The number of templates.
+ */
+size_t ObjectTemplates::getCount() const
+{
+    return mTemplates.size();
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "ObjectTypeRegistry.h"
+#include "GoldObject.h"
+#include "WeaponObject.h"
+#include "ArmorObject.h"
+#include "ConsumableObject.h"
+#include "SqlReader.h"
+
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Struct describing a type that is registered when the registry is created.
+ */
+struct BuiltinType
+{
+    const char *mName;                            ///< Name of the type in the Objecttypen table.
+    ObjectType mType;                             ///< Type of the objects.
+    ObjectTypeRegistry::Constructor mConstructor; ///< Creates the objects of the type.
+};
+
+/**
+ * @brief The built-in types. A new type is added with a row here.
+ */
+static const BuiltinType BuiltinTypes[] = {
+    {"goudstukken", ObjectType::Gold, &ObjectTypeRegistry::construct<GoldObject>},
+    {"wapen", ObjectType::Weapon, &ObjectTypeRegistry::construct<WeaponObject>},
+    {"wapenrusting", ObjectType::Armor, &ObjectTypeRegistry::construct<ArmorObject>},
+    {"levenselixer", ObjectType::Consumable_Health, &ObjectTypeRegistry::construct<ConsumableObject>},
+    {"ervaringsdrank", ObjectType::Consumable_Experience, &ObjectTypeRegistry::construct<ConsumableObject>},
+    {"teleportatiedrank", ObjectType::Consumable_Teleport, &ObjectTypeRegistry::construct<ConsumableObject>},
+};
+
+/**
+ * @brief Constructs the registry with the built-in types and checks them against the Objecttypen table.
+ */
+ObjectTypeRegistry::ObjectTypeRegistry()
+{
+    for (const BuiltinType &builtin : BuiltinTypes)
+    {
+        registerType(builtin.mName, builtin.mType, builtin.mConstructor);
+    }
+
+    Sean::Vector<Sean::String> rows;
+    if (SQLReader::getInstance().getAllObjectTypes(rows))
+    {
+        for (size_t i = 0; i < rows.size(); ++i)
+        {
+            if (find(rows[i]) == InvalidType)
+            {
+                std::cerr << "Object type not registered: " << rows[i] << std::endl;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Gets the singleton instance of ObjectTypeRegistry.
+ *
+ * @return ObjectTypeRegistry& Reference to the singleton instance of ObjectTypeRegistry.
+ */
+ObjectTypeRegistry &ObjectTypeRegistry::getInstance()
+{
+    static ObjectTypeRegistry instance;
+    return instance;
+}
+
+/**
+ * @brief Registers a type, or replaces the type with the same name.
+ *
+ * @param aName The name of the type in the Objecttypen table.
+ * @param aType The type of the objects.
+ * @param aConstructor Creates the objects of the type.
+ * @return uint32_t The index of the type.
+ * @throws std::invalid_argument if the constructor is null.
+ */
+uint32_t ObjectTypeRegistry::registerType(const Sean::String &aName, ObjectType aType, Constructor aConstructor)
+{
+    if (aConstructor == nullptr)
+    {
+        throw std::invalid_argument("Invalid object type constructor");
+    }
+
+    std::string key(aName.c_str());
+    auto iter = mIndexes.find(key);
+    if (iter != mIndexes.end())
+    {
+        mEntries[iter->second] = {aName, aType, aConstructor};
+        return iter->second;
+    }
+
+    uint32_t index = static_cast<uint32_t>(mEntries.size());
+    mEntries.push_back({aName, aType, aConstructor});
+    mIndexes.emplace(std::move(key), index);
+    return index;
+}
+
+/**
+ * @brief Gets the index of a type.
+ *
+ * @param aName The name of the type in the Objecttypen table.
+ * @return uint32_t The index of the type, or InvalidType if it is not registered.
+ */
+uint32_t ObjectTypeRegistry::find(const Sean::String &aName) const
+{
+    auto iter = mIndexes.find(aName.c_str());
+    if (iter == mIndexes.end())
+    {
+        return InvalidType;
+    }
+    return iter->second;
+}
+
+/**
+ * @brief Gets a registered type.
+ *
+ * @param aIndex The index of the type.
+ * @return const Entry& The type.
+ * @throws std::out_of_range if the index is invalid.
+ */
+const ObjectTypeRegistry::Entry &ObjectTypeRegistry::get(uint32_t aIndex) const
+{
+    if (aIndex >= mEntries.size())
+    {
+        throw std::out_of_range("Invalid object type");
+    }
+    return mEntries[aIndex];
+}
+
+/**
+ * @brief Gets the number of registered types.
+ *
+ * @return size_t The number of types.
+ */
+size_t ObjectTypeRegistry::getCount() const
+{
+    return mEntries.size();
+}
+
+/**
+ * @brief Gets the template of an object of a registered type from a row of the Objecten table.
+ *
+ * Armor takes its value from the protection, the other types from the minimum and maximum.
+ *
+ * @param aIndex The index of the type.
+ * @param aName The name of the object.
+ * @param aDescription The description of the object.
+ * @param aMinimum The minimum value of the object.
+ * @param aMaximum The maximum value of the object.
+ * @param aProtection The protection of the object.
+ * @return uint32_t The index of the template in ObjectTemplates.
+ * @throws std::out_of_range if the index is invalid.
+ */
+uint32_t ObjectTypeRegistry::internTemplate(uint32_t aIndex, const Sean::String &aName, const Sean::String &aDescription, int aMinimum, int aMaximum, int aProtection) const
+{
+    const Entry &entry = get(aIndex);
+    if (entry.mType == ObjectType::Armor)
+    {
+        aMinimum = aProtection;
+        aMaximum = aProtection;
+    }
+    return ObjectTemplates::getInstance().intern(aName, aDescription, entry.mType, aMinimum, aMaximum);
+}
+
+/**
+ * @brief Creates an object of a registered type from a row of the Objecten table.
+ *
+ * @param aIndex The index of the type.
+ * @param aName The name of the object.
+ * @param aDescription The description of the object.
+ * @param aMinimum The minimum value of the object.
+ * @param aMaximum The maximum value of the object.
+ * @param aProtection The protection of the object.
+ * @param aID The ID of the object.
+ * @return GameObject* The new object, owned by the caller.
+ * @throws std::out_of_range if the index is invalid.
+ */
+GameObject *ObjectTypeRegistry::create(uint32_t aIndex, const Sean::String &aName, const Sean::String &aDescription, int aMinimum, int aMaximum, int aProtection, int aID) const
+{
+    return create(aIndex, internTemplate(aIndex, aName, aDescription, aMinimum, aMaximum, aProtection), aID);
+}
+
+/**
+ * @brief Creates an object of a registered type from a template that was already interned.
+ *
+ * @param aIndex The index of the type.
+ * @param aTemplate The index of the template in ObjectTemplates, as returned by internTemplate.
+ * @param aID The ID of the object.
+ * @return GameObject* The new object, owned by the caller.
+ * @throws std::out_of_range if the index is invalid.
+ */
+GameObject *ObjectTypeRegistry::create(uint32_t aIndex, uint32_t aTemplate, int aID) const
+{
+    return get(aIndex).mConstructor(ObjectValue(aTemplate, aID));
+}
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include "ObjectValue.h"
+#include "GoldObject.h"
+#include "WeaponObject.h"
+#include "ArmorObject.h"
+#include "ConsumableObject.h"
+#include "RandomGenerator.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Constructs the value of an empty object, with the empty template.
+ */
+ObjectValue::ObjectValue()
+    : mType(ObjectType::Gold), mTemplate(ObjectTemplates::EmptyTemplate), mID(0)
+{
+}
+
+/**
+ * @brief Constructs the value of an object.
+ *
+ * @param aTemplate The index of the template of the object.
+ * @param aID The ID of the object.
+ * @throws std::out_of_range if the template does not exist.
+ */
+ObjectValue::ObjectValue(uint32_t aTemplate, int aID)
+    : mType(ObjectTemplates::getInstance().get(aTemplate).mType), mTemplate(aTemplate), mID(aID)
+{
+}
+
+/**
+ * @brief Gets the type of the object.
+ *
+ * @return ObjectType The type of the object.
+ */
+ObjectType ObjectValue::getType() const
+{
+    return mType;
+}
+
+/**
+ * @brief Checks if the object is a weapon.
+ *
+ * @return bool True if the object is a weapon, false otherwise.
+ */
+bool ObjectValue::isWeapon() const
+{
+    return mType == ObjectType::Weapon;
+}
+
+/**
+ * @brief Checks if the object is armor.
+ *
+ * @return bool True if the object is armor, false otherwise.
+ */
+bool ObjectValue::isArmor() const
+{
+    return mType == ObjectType::Armor;
+}
+
+/**
+ * @brief Checks if the object is a health consumable.
+ *
+ * @return bool True if the object is a health consumable, false otherwise.
+ */
+bool ObjectValue::isConsumableHealth() const
+{
+    return mType == ObjectType::Consumable_Health;
+}
+
+/**
+ * @brief Checks if the object is an experience consumable.
+ *
+ * @return bool True if the object is an experience consumable, false otherwise.
+ */
+bool ObjectValue::isConsumableExperience() const
+{
+    return mType == ObjectType::Consumable_Experience;
+}
+
+/**
+ * @brief Checks if the object is a teleport consumable.
+ *
+ * @return bool True if the object is a teleport consumable, false otherwise.
+ */
+bool ObjectValue::isConsumableTeleport() const
+{
+    return mType == ObjectType::Consumable_Teleport;
+}
+
+/**
+ * @brief Checks if the object is money (gold).
+ *
+ * @return bool True if the object is money, false otherwise.
+ */
+bool ObjectValue::isMoney() const
+{
+    return mType == ObjectType::Gold;
+}
+
+/**
+ * @brief Gets the index of the template of the object.
+ *
+ * @return uint32_t The index in ObjectTemplates.
+ */
+uint32_t ObjectValue::getTemplateId() const
+{
+    return mTemplate;
+}
+
+/**
+ * @brief Gets the template with the name, description and value range of the object.
+ *
+ * @return const ObjectTemplates::Template& The template.
+ */
+const ObjectTemplates::Template &ObjectValue::getTemplate() const
+{
+    return ObjectTemplates::getInstance().get(mTemplate);
+}
+
+/**
+ * @brief Gets the ID of the object.
+ *
+ * @return int The ID.
+ */
+int ObjectValue::getID() const
+{
+    return mID;
+}
+
+/**
+ * @brief Gets the name of the object, followed by its ID.
+ *
+ * @return Sean::String The name of the object.
+ */
+Sean::String ObjectValue::getName() const
+{
+    return getTemplate().mName + (std::to_string(mID).c_str());
+}
+
+/**
+ * @brief Checks whether a name is the name of the object, without building the name.
+ *
+ * @param aName The name to compare, the template name followed by the ID.
+ * @return true If the name is the name of the object.
+ * @return false Otherwise.
+ */
+bool ObjectValue::hasName(const char *aName) const
+{
+    const Sean::String &templateName = getTemplate().mName;
+    if (std::strncmp(aName, templateName.c_str(), templateName.size()) != 0)
+    {
+        return false;
+    }
+
+    // Write the ID backwards into a buffer and compare it with the rest of the name
+    char digits[12];
+    char *end = digits + sizeof(digits);
+    char *begin = end;
+    uint32_t id = mID < 0 ? 0u - static_cast<uint32_t>(mID) : static_cast<uint32_t>(mID);
+    do
+    {
+        *--begin = static_cast<char>('0' + id % 10);
+        id /= 10;
+    } while (id != 0);
+    if (mID < 0)
+    {
+        *--begin = '-';
+    }
+    const char *suffix = aName + templateName.size();
+    size_t length = static_cast<size_t>(end - begin);
+    return std::strncmp(suffix, begin, length) == 0 && suffix[length] == '\0';
+}
+
+/**
+ * @brief Prints the name of the object to the standard output.
+ */
+void ObjectValue::printName() const
+{
+    std::cout << getName() << std::endl;
+}
+
+/**
+ * @brief Prints the description and the value range of the object.
+ */
+void ObjectValue::printDescription() const
+{
+    const ObjectTemplates::Template &objectTemplate = getTemplate();
+    std::cout << objectTemplate.mDescription << std::endl;
+    switch (mType)
+    {
+    case ObjectType::Gold:
+        std::cout << "Bevat tussen " << objectTemplate.mMinimum << " - " << objectTemplate.mMaximum << " goudstukken" << std::endl;
+        break;
+    case ObjectType::Weapon:
+        std::cout << "Schade tussen: " << objectTemplate.mMinimum << " - " << objectTemplate.mMaximum << std::endl;
+        break;
+    case ObjectType::Armor:
+        std::cout << "Armor: " << objectTemplate.mMinimum << std::endl;
+        break;
+    case ObjectType::Consumable_Health:
+    case ObjectType::Consumable_Experience:
+    case ObjectType::Consumable_Teleport:
+        std::cout << "Sterkte tussen: " << objectTemplate.mMinimum << " - " << objectTemplate.mMaximum << std::endl;
+        break;
+    }
+}
+
+/**
+ * @brief Gets the value of the object: the armor value, or a random value between the minimum and maximum.
+ *
+ * @return int The value of the object.
+ */
+int ObjectValue::getValue() const
+{
+    const ObjectTemplates::Template &objectTemplate = getTemplate();
+    if (mType == ObjectType::Armor)
+    {
+        return objectTemplate.mMinimum;
+    }
+    RandomGenerator randomEngine;
+    return randomEngine.getRandomValue(objectTemplate.mMinimum, objectTemplate.mMaximum);
+}
+
+/**
+ * @brief Gets the minimum value of the object.
+ *
+ * @return int The minimum value.
+ */
+int ObjectValue::getMin() const
+{
+    return getTemplate().mMinimum;
+}
+
+/**
+ * @brief Gets the maximum value of the object.
+ *
+ * @return int The maximum value.
+ */
+int ObjectValue::getMax() const
+{
+    return getTemplate().mMaximum;
+}
+
+/**
+ * @brief Creates the GameObject that wraps this value, for code that works with object pointers.
+ *
+ * @return GameObject* The new object, owned by the caller.
+ */
+GameObject *ObjectValue::toObject() const
+{
+    switch (mType)
+    {
+    case ObjectType::Gold:
+        return new GoldObject(*this);
+    case ObjectType::Weapon:
+        return new WeaponObject(*this);
+    case ObjectType::Armor:
+        return new ArmorObject(*this);
+    case ObjectType::Consumable_Health:
+    case ObjectType::Consumable_Experience:
+    case ObjectType::Consumable_Teleport:
+        break;
+    }
+    return new ConsumableObject(*this);
+}
\ No newline at end of file
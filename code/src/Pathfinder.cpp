@@ -0,0 +1,464 @@
+#include "Pathfinder.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Constructs a pathfinder without cached fields.
+ */
+Pathfinder::Pathfinder()
+    : mVisitMark(0), mUseCounter(0)
+{
+}
+
+/**
+ * @brief Copy constructor, the cached fields are shared with the other pathfinder.
+ *
+ * @param aOther The pathfinder to copy.
+ */
+Pathfinder::Pathfinder(const Pathfinder &aOther)
+    : mFields(aOther.mFields), mVisitMark(0), mUseCounter(aOther.mUseCounter)
+{
+}
+
+/**
+ * @brief Copy assignment operator, the cached fields are shared with the other pathfinder.
+ *
+ * @param aOther The pathfinder to copy.
+ * @return Pathfinder& A reference to this pathfinder.
+ */
+Pathfinder &Pathfinder::operator=(const Pathfinder &aOther)
+{
+    if (this != &aOther)
+    {
+        mFields = aOther.mFields;
+        mRings.clear();
+        mUseCounter = aOther.mUseCounter;
+    }
+    return *this;
+}
+
+/**
+ * @brief Gets the distance field towards a set of target rooms.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aTargets The target rooms.
+ * @return const std::vector<uint32_t>& Per room the number of steps to the nearest target, or Unreachable.
+ * @throws std::out_of_range if a target is not a room of the graph.
+ */
+const std::vector<uint32_t> &Pathfinder::getDistanceField(const RoomGraph &aGraph, const std::vector<uint32_t> &aTargets)
+{
+    return *findField(aGraph, aTargets).mDistances;
+}
+
+/**
+ * @brief Gets the number of steps from a room to the nearest of a set of target rooms.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aFrom The room to start from.
+ * @param aTargets The target rooms.
+ * @return uint32_t The number of steps, or Unreachable.
+ * @throws std::out_of_range if a room is not a room of the graph.
+ */
+uint32_t Pathfinder::getDistance(const RoomGraph &aGraph, uint32_t aFrom, const std::vector<uint32_t> &aTargets)
+{
+    const std::vector<uint32_t> &distances = *findField(aGraph, aTargets).mDistances;
+    if (aFrom >= distances.size())
+    {
+        throw std::out_of_range("Invalid room");
+    }
+    return distances[aFrom];
+}
+
+/**
+ * @brief Gets the first step of a shortest route, for example for an enemy chasing the player.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aFrom The room to start from.
+ * @param aTargets The target rooms.
+ * @return uint32_t The room to move to, or RoomGraph::NoRoom if aFrom is a target or no target can be reached.
+ * @throws std::out_of_range if a room is not a room of the graph.
+ */
+uint32_t Pathfinder::getNextStep(const RoomGraph &aGraph, uint32_t aFrom, const std::vector<uint32_t> &aTargets)
+{
+    const Field &field = findField(aGraph, aTargets);
+    if (aFrom >= field.mDistances->size())
+    {
+        throw std::out_of_range("Invalid room");
+    }
+    return nextStep(aGraph, field, aFrom);
+}
+
+/**
+ * @brief Finds a shortest route from a room to the nearest of a set of target rooms.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aFrom The room to start from.
+ * @param aTargets The target rooms.
+ * @param aPath Filled with the rooms of the route after aFrom, ending in a target. Empty if aFrom is a target.
+ * @return bool True if a target can be reached, false otherwise.
+ * @throws std::out_of_range if a room is not a room of the graph.
+ */
+bool Pathfinder::findPath(const RoomGraph &aGraph, uint32_t aFrom, const std::vector<uint32_t> &aTargets, std::vector<uint32_t> &aPath)
+{
+    const Field &field = findField(aGraph, aTargets);
+    const std::vector<uint32_t> &distances = *field.mDistances;
+    if (aFrom >= distances.size())
+    {
+        throw std::out_of_range("Invalid room");
+    }
+
+    aPath.clear();
+    if (distances[aFrom] == Unreachable)
+    {
+        return false;
+    }
+    aPath.reserve(distances[aFrom]);
+    for (uint32_t room = aFrom; distances[room] > 0;)
+    {
+        room = nextStep(aGraph, field, room);
+        aPath.push_back(room);
+    }
+    return true;
+}
+
+/**
+ * @brief Draws a random room at a given number of steps from a room, for example for a teleport.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aFrom The room to start from.
+ * @param aHops The number of steps. If no room is that far away, the farthest rooms are used instead.
+ * @param aRandom A random value that picks the room within the ring.
+ * @return uint32_t The room, aFrom itself only if no other room can be reached.
+ * @throws std::out_of_range if aFrom is not a room of the graph.
+ */
+uint32_t Pathfinder::getRoomAtDistance(const RoomGraph &aGraph, uint32_t aFrom, uint32_t aHops, uint64_t aRandom)
+{
+    const Rings &rings = findRings(aGraph, aFrom, aHops);
+    uint32_t ring = std::min<uint32_t>(aHops, static_cast<uint32_t>(rings.mRingOffsets.size()) - 2);
+    uint32_t begin = rings.mRingOffsets[ring];
+    uint32_t size = rings.mRingOffsets[ring + 1] - begin;
+    return rings.mRooms[begin + static_cast<uint32_t>(aRandom % size)];
+}
+
+/**
+ * @brief Updates the cached fields after an exit was added to the graph.
+ *
+ * A new exit can only shorten routes, so the shorter distances are spread from the room over
+ * the exits arriving in it, without searching the rest of the dungeon. Distances that are still
+ * shared with a copy are copied before they change. Cached rings are dropped.
+ *
+ * @param aGraph The graph of the dungeon, already containing the exit.
+ * @param aRoom The room the exit leaves from.
+ * @param aTarget The room the exit leads to.
+ */
+void Pathfinder::exitAdded(const RoomGraph &aGraph, uint32_t aRoom, uint32_t aTarget)
+{
+    mRings.clear();
+    std::vector<uint32_t> queue;
+    for (Field &field : mFields)
+    {
+        const std::vector<uint32_t> &current = *field.mDistances;
+        if (current[aTarget] == Unreachable || current[aTarget] + 1 >= current[aRoom])
+        {
+            continue;
+        }
+        if (field.mDistances.use_count() > 1)
+        {
+            field.mDistances = std::make_shared<std::vector<uint32_t>>(*field.mDistances);
+        }
+
+        std::vector<uint32_t> &distances = *field.mDistances;
+        distances[aRoom] = distances[aTarget] + 1;
+        queue.assign(1, aRoom);
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            uint32_t room = queue[head];
+            const uint32_t *predecessors = aGraph.getPredecessors(room);
+            uint32_t predecessorCount = aGraph.getPredecessorCount(room);
+            for (uint32_t i = 0; i < predecessorCount; ++i)
+            {
+                if (distances[room] + 1 < distances[predecessors[i]])
+                {
+                    distances[predecessors[i]] = distances[room] + 1;
+                    queue.push_back(predecessors[i]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Updates the cached fields after an exit was removed from the graph.
+ *
+ * Fields in which the exit was not part of a shortest route stay valid. The other fields and
+ * all cached rings are dropped and searched again when they are next needed.
+ *
+ * @param aGraph The graph of the dungeon, no longer containing the exit.
+ * @param aRoom The room the exit left from.
+ * @param aTarget The room the exit led to.
+ */
+void Pathfinder::exitRemoved(const RoomGraph &aGraph, uint32_t aRoom, uint32_t aTarget)
+{
+    mRings.clear();
+    auto invalid = std::remove_if(mFields.begin(), mFields.end(),
+                                  [&](const Field &aField)
+                                  {
+                                      const std::vector<uint32_t> &distances = *aField.mDistances;
+                                      if (distances[aTarget] == Unreachable || distances[aTarget] + 1 != distances[aRoom])
+                                      {
+                                          return false;
+                                      }
+                                      return nextStep(aGraph, aField, aRoom) == RoomGraph::NoRoom;
+                                  });
+    mFields.erase(invalid, mFields.end());
+}
+
+/**
+ * @brief Drops all cached fields and rings.
+ */
+void Pathfinder::clear()
+{
+    mFields.clear();
+    mRings.clear();
+}
+
+/**
+ * @brief Gets the number of cached distance fields.
+ *
+ * @return size_t The number of fields.
+ */
+size_t Pathfinder::getCachedFieldCount() const
+{
+    return mFields.size();
+}
+
+/**
+ * @brief Gets the number of start rooms whose rings are cached.
+ *
+ * @return size_t The number of cached rings.
+ */
+size_t Pathfinder::getCachedRingsCount() const
+{
+    return mRings.size();
+}
+
+// Private Methods
+
+/**
+ * @brief Gets the cached field of a set of targets, computing it if needed.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aTargets The target rooms.
+ * @return Field& The field.
+ * @throws std::out_of_range if a target is not a room of the graph.
+ */
+Pathfinder::Field &Pathfinder::findField(const RoomGraph &aGraph, const std::vector<uint32_t> &aTargets)
+{
+    std::vector<uint32_t> targets(aTargets);
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+    if (!targets.empty() && targets.back() >= aGraph.getRoomCount())
+    {
+        throw std::out_of_range("Invalid room");
+    }
+
+    ++mUseCounter;
+    for (Field &field : mFields)
+    {
+        if (field.mTargets == targets)
+        {
+            field.mLastUsed = mUseCounter;
+            return field;
+        }
+    }
+
+    // Replace the least recently used field once the cache is full
+    auto slot = mFields.end();
+    if (mFields.size() >= MaxCachedFields)
+    {
+        slot = std::min_element(mFields.begin(), mFields.end(),
+                                [](const Field &aLeft, const Field &aRight)
+                                {
+                                    return aLeft.mLastUsed < aRight.mLastUsed;
+                                });
+    }
+    else
+    {
+        slot = mFields.insert(mFields.end(), Field());
+    }
+    slot->mTargets = std::move(targets);
+    slot->mLastUsed = mUseCounter;
+    computeField(aGraph, *slot);
+    return *slot;
+}
+
+/**
+ * @brief Gets the cached rings around a room, building them if needed.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aFrom The start room.
+ * @param aHops The distance up to which the rings are needed.
+ * @return Rings& The rings.
+ * @throws std::out_of_range if aFrom is not a room of the graph.
+ */
+Pathfinder::Rings &Pathfinder::findRings(const RoomGraph &aGraph, uint32_t aFrom, uint32_t aHops)
+{
+    if (aFrom >= aGraph.getRoomCount())
+    {
+        throw std::out_of_range("Invalid room");
+    }
+
+    ++mUseCounter;
+    auto slot = std::find_if(mRings.begin(), mRings.end(),
+                             [&](const Rings &aRings)
+                             {
+                                 return aRings.mFrom == aFrom;
+                             });
+    if (slot != mRings.end())
+    {
+        // Rings that ended before the needed distance already hold every reachable room
+        bool complete = slot->mRingOffsets.size() - 2 < slot->mHops;
+        if (slot->mHops >= aHops || complete)
+        {
+            slot->mLastUsed = mUseCounter;
+            return *slot;
+        }
+    }
+    else if (mRings.size() >= MaxCachedRings)
+    {
+        slot = std::min_element(mRings.begin(), mRings.end(),
+                                [](const Rings &aLeft, const Rings &aRight)
+                                {
+                                    return aLeft.mLastUsed < aRight.mLastUsed;
+                                });
+    }
+    else
+    {
+        slot = mRings.insert(mRings.end(), Rings());
+    }
+    slot->mFrom = aFrom;
+    slot->mHops = aHops;
+    slot->mLastUsed = mUseCounter;
+    buildRings(aGraph, *slot);
+    return *slot;
+}
+
+/**
+ * @brief Builds the rings around a room with a breadth-first search that stops at the needed distance.
+ *
+ * Only the rooms within that distance are visited, so small distances stay cheap on large dungeons.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aRings The rings to build, their start room and distance must be set.
+ */
+void Pathfinder::buildRings(const RoomGraph &aGraph, Rings &aRings)
+{
+    if (mVisited.size() != aGraph.getRoomCount() || mVisitMark == 0xFFFFFFFF)
+    {
+        mVisited.assign(aGraph.getRoomCount(), 0);
+        mVisitMark = 0;
+    }
+    ++mVisitMark;
+
+    aRings.mRooms.assign(1, aRings.mFrom);
+    aRings.mRingOffsets.assign(1, 0);
+    mVisited[aRings.mFrom] = mVisitMark;
+
+    // Each pass over the previous ring adds the next one
+    for (uint32_t hop = 0; hop < aRings.mHops; ++hop)
+    {
+        uint32_t begin = aRings.mRingOffsets.back();
+        uint32_t end = static_cast<uint32_t>(aRings.mRooms.size());
+        aRings.mRingOffsets.push_back(end);
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            uint32_t room = aRings.mRooms[i];
+            const uint32_t *neighbours = aGraph.getNeighbours(room);
+            uint32_t neighbourCount = aGraph.getNeighbourCount(room);
+            for (uint32_t n = 0; n < neighbourCount; ++n)
+            {
+                if (mVisited[neighbours[n]] != mVisitMark)
+                {
+                    mVisited[neighbours[n]] = mVisitMark;
+                    aRings.mRooms.push_back(neighbours[n]);
+                }
+            }
+        }
+        if (aRings.mRooms.size() == end)
+        {
+            // No room is farther away
+            aRings.mRingOffsets.pop_back();
+            break;
+        }
+    }
+    aRings.mRingOffsets.push_back(static_cast<uint32_t>(aRings.mRooms.size()));
+}
+
+/**
+ * @brief Computes the distances of a field with one breadth-first search from all its targets.
+ *
+ * The distances are stored in a new array, an evicted field may still be shared with a copy.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aField The field to compute, its targets must be set.
+ */
+void Pathfinder::computeField(const RoomGraph &aGraph, Field &aField)
+{
+    aField.mDistances = std::make_shared<std::vector<uint32_t>>(aGraph.getRoomCount(), Unreachable);
+    std::vector<uint32_t> &distances = *aField.mDistances;
+
+    std::vector<uint32_t> queue;
+    queue.reserve(aGraph.getRoomCount());
+    for (uint32_t target : aField.mTargets)
+    {
+        distances[target] = 0;
+        queue.push_back(target);
+    }
+
+    // Walk the exits backwards, a room is as far as the room its exit leads to plus one
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        uint32_t room = queue[head];
+        const uint32_t *predecessors = aGraph.getPredecessors(room);
+        uint32_t predecessorCount = aGraph.getPredecessorCount(room);
+        for (uint32_t i = 0; i < predecessorCount; ++i)
+        {
+            if (distances[predecessors[i]] == Unreachable)
+            {
+                distances[predecessors[i]] = distances[room] + 1;
+                queue.push_back(predecessors[i]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Gets the neighbour of a room that is one step closer to the targets of a field.
+ *
+ * @param aGraph The graph of the dungeon.
+ * @param aField The field.
+ * @param aFrom The room to step from.
+ * @return uint32_t The neighbour, or RoomGraph::NoRoom if there is none.
+ */
+uint32_t Pathfinder::nextStep(const RoomGraph &aGraph, const Field &aField, uint32_t aFrom)
+{
+    const std::vector<uint32_t> &distances = *aField.mDistances;
+    uint32_t distance = distances[aFrom];
+    if (distance == 0 || distance == Unreachable)
+    {
+        return RoomGraph::NoRoom;
+    }
+
+    const uint32_t *neighbours = aGraph.getNeighbours(aFrom);
+    uint32_t neighbourCount = aGraph.getNeighbourCount(aFrom);
+    for (uint32_t i = 0; i < neighbourCount; ++i)
+    {
+        if (distances[neighbours[i]] + 1 == distance)
+        {
+            return neighbours[i];
+        }
+    }
+    return RoomGraph::NoRoom;
+}
\ No newline at end of file
@@ -1,8 +1,10 @@
 #include "Player.h"
 
+#include <cstring>
+#include <functional>
 #include <iostream>
 #include <stdexcept>
-#include <algorithm>
+#include <string_view>
 #include "RandomGenerator.h"
 
 // Constructors
@@ -11,7 +13,7 @@
  * @brief Constructs a Player object with default attributes.
  */
 Player::Player()
-    : mHealth(20), mAttackPercentage(40), mGold(0), mGodMode(false), mEquippedWeapon(nullptr), mEquippedArmor(nullptr)
+    : mHealth(20), mAttackPercentage(40), mGold(0), mGodMode(false), mEquippedWeapon(NoSlot), mEquippedArmor(NoSlot)
 {
     std::cout << "Wat is je naam? ";
     std::cin >> mName;
@@ -30,9 +32,9 @@ void Player::printDescription() const
     std::cout << "Goud: " << mGold << std::endl;
     // print equipped weapon
     std::cout << "Uitgeruste wapen: ";
-    if (mEquippedWeapon)
+    if (mEquippedWeapon != NoSlot)
     {
-        mEquippedWeapon->printName();
+        mInventory[mEquippedWeapon].printName();
     }
     else
     {
@@ -40,9 +42,9 @@ void Player::printDescription() const
     }
     // print equipped armor
     std::cout << "Uitgeruste pantser: ";
-    if (mEquippedArmor)
+    if (mEquippedArmor != NoSlot)
     {
-        mEquippedArmor->printName();
+        mInventory[mEquippedArmor].printName();
     }
     else
     {
@@ -51,10 +53,10 @@ void Player::printDescription() const
 
     // print inventory
     std::cout << "Inventaris: " << std::endl;
-    for (const auto &item : mInventory)
+    for (const ObjectValue &item : mInventory)
     {
         std::cout << "\t";
-        item->printName();
+        item.printName();
     }
     std::cout << "Godmode: " << (mGodMode ? "Ja" : "Nee") << std::endl;
 }
@@ -62,89 +64,70 @@ void Player::printDescription() const
 /**
  * @brief Equips an object from the player's inventory.
  * 
+ * The previously equipped item of the same kind is moved out of the inventory and returned.
+ * 
  * @param aItem The name of the item to equip.
- * @return std::unique_ptr<IGameObject> The previously equipped item, if any.
+ * @param aPreviousItem Set to the previously equipped item, if any.
+ * @return bool True if a previously equipped item was taken off, false otherwise.
  */
-std::unique_ptr<IGameObject> Player::equipObject(const char *aItem)
+bool Player::equipObject(const char *aItem, ObjectValue &aPreviousItem)
 {
-    std::unique_ptr<IGameObject> previousItem = nullptr;
+    bool replaced = false;
 
-    // Check if the item is already equipped
-    if ((mEquippedWeapon && mEquippedWeapon->getName() == aItem) ||
-        (mEquippedArmor && mEquippedArmor->getName() == aItem))
+    size_t slot = findSlot(aItem);
+    if (slot != NoSlot && (slot == mEquippedWeapon || slot == mEquippedArmor))
     {
         std::cout << "Item " << aItem << " is al uitgerust." << std::endl;
-        return nullptr;
+        return false;
     }
-
-    // Find item in the inventory
-    auto itemIter = std::find_if(mInventory.begin(), mInventory.end(),
-                                 [&](const std::unique_ptr<IGameObject> &item)
-                                 {
-                                     return item->getName() == aItem;
-                                 });
-
-    if (itemIter == mInventory.end())
+    if (slot == NoSlot)
     {
         std::cout << "Item " << aItem << " niet gevonden in je rugzak." << std::endl;
-        return nullptr;
+        return false;
     }
 
-    // Equip weapon or armor, replacing any currently equipped item
-    auto &item = *itemIter;
-    if (item->isWeapon())
+    // Equip weapon or armor, replacing any currently equipped item. Removing the previous item
+    // may move this item to another slot, its index entry follows it.
+    const ObjectValue &item = mInventory[slot];
+    InventoryIndex::value_type *entry = mInventoryEntries[slot];
+    if (item.isWeapon())
     {
-        if (mEquippedWeapon)
+        if (mEquippedWeapon != NoSlot)
         {
-            previousItem = std::unique_ptr<IGameObject>(mEquippedWeapon->clone());
-            removeEquippedItem(mEquippedWeapon);
+            aPreviousItem = removeSlot(mEquippedWeapon);
+            replaced = true;
         }
-        // Find item in the inventory
-        auto weaponIter = std::find_if(mInventory.begin(), mInventory.end(),
-                                       [&](const std::unique_ptr<IGameObject> &item)
-                                       {
-                                           return item->getName() == aItem;
-                                       });
-        auto &weapon = *weaponIter;
-        mEquippedWeapon = weapon.get();
+        mEquippedWeapon = entry->second;
         std::cout << "Wapen uitgerust: " << aItem << std::endl;
     }
-    else if (item->isArmor())
+    else if (item.isArmor())
     {
-        if (mEquippedArmor)
+        if (mEquippedArmor != NoSlot)
         {
-            previousItem = std::unique_ptr<IGameObject>(mEquippedArmor->clone());
-            removeEquippedItem(mEquippedArmor);
+            aPreviousItem = removeSlot(mEquippedArmor);
+            replaced = true;
         }
-        // Find item in the inventory
-        auto armorIter = std::find_if(mInventory.begin(), mInventory.end(),
-                                      [&](const std::unique_ptr<IGameObject> &item)
-                                      {
-                                          return item->getName() == aItem;
-                                      });
-        auto &armor = *armorIter;
-        mEquippedArmor = armor.get();
+        mEquippedArmor = entry->second;
         std::cout << "Pantser uitgerust: " << aItem << std::endl;
     }
 
-    return previousItem;
+    return replaced;
 }
 
 /**
  * @brief Removes an equipped item from the player's inventory.
  * 
- * @param equippedItem Pointer to the equipped item to remove.
+ * @param equippedItem Pointer to the equipped item in the inventory.
  */
-void Player::removeEquippedItem(IGameObject *equippedItem)
+void Player::removeEquippedItem(const ObjectValue *equippedItem)
 {
-    auto iter = std::find_if(mInventory.begin(), mInventory.end(),
-                             [&](const std::unique_ptr<IGameObject> &item)
-                             {
-                                 return item.get() == equippedItem;
-                             });
-    if (iter != mInventory.end())
+    if (mEquippedWeapon != NoSlot && &mInventory[mEquippedWeapon] == equippedItem)
+    {
+        removeSlot(mEquippedWeapon);
+    }
+    else if (mEquippedArmor != NoSlot && &mInventory[mEquippedArmor] == equippedItem)
     {
-        mInventory.erase(iter);
+        removeSlot(mEquippedArmor);
     }
 }
 
@@ -161,9 +144,9 @@ void Player::addHealth(int aHealth)
     }
     if (aHealth < 0)
     {
-        if (mEquippedArmor)
+        if (mEquippedArmor != NoSlot)
         {
-            aHealth += mEquippedArmor->getValue();
+            aHealth += mInventory[mEquippedArmor].getValue();
             if (aHealth > 0)
             {
                 aHealth = 0;
@@ -192,17 +175,17 @@ void Player::addExperience(int aExperience)
 /**
  * @brief Adds an object to the player's inventory. If the object is money, it increases the player's gold.
  * 
- * @param aObject The object to add.
+ * @param aObject The value of the object to add.
  */
-void Player::addObject(std::unique_ptr<IGameObject> aObject)
+void Player::addObject(const ObjectValue &aObject)
 {
-    if (aObject->isMoney())
+    if (aObject.isMoney())
     {
-        mGold += aObject->getValue();
+        mGold += aObject.getValue();
     }
     else
     {
-        mInventory.push_back(std::move(aObject));
+        addToSlot(aObject);
     }
 }
 
@@ -214,44 +197,60 @@ void Player::addObject(std::unique_ptr<IGameObject> aObject)
  */
 bool Player::printObject(const char *aObjectName) const
 {
-    for (const auto &obj : mInventory)
+    const ObjectValue *object = findObject(aObjectName);
+    if (object == nullptr)
     {
-        if (obj->getName() == aObjectName)
-        {
-            obj->printName();
-            obj->printDescription();
-            return true;
-        }
+        return false;
     }
-    return false;
+    object->printName();
+    object->printDescription();
+    return true;
 }
 
 /**
  * @brief Drops an object from the player's inventory by name.
  * 
  * @param aObjectName The name of the object to drop.
- * @return std::unique_ptr<IGameObject> The dropped object.
+ * @param aObject Set to the value of the dropped object.
+ * @return bool True if the object was found and dropped, false otherwise.
  */
-std::unique_ptr<IGameObject> Player::dropObject(const char *aObjectName)
+bool Player::dropObject(const char *aObjectName, ObjectValue &aObject)
 {
-    for (auto iter = mInventory.begin(); iter != mInventory.end(); ++iter)
+    size_t slot = findSlot(aObjectName);
+    if (slot == NoSlot)
     {
-        if (iter->get()->getName() == aObjectName)
-        {
-            if (mEquippedWeapon == iter->get())
-            {
-                mEquippedWeapon = nullptr;
-            }
-            if (mEquippedArmor == iter->get())
-            {
-                mEquippedArmor = nullptr;
-            }
-            std::unique_ptr<IGameObject> droppedItem = std::move(*iter);
-            mInventory.erase(iter);
-            return droppedItem;
-        }
+        return false;
+    }
+    aObject = removeSlot(slot);
+    return true;
+}
+
+/**
+ * @brief Removes an object found in the player's inventory, without looking up its name again.
+ * 
+ * @param aObject Pointer to the object in the inventory, as returned by findObject.
+ * @return bool True if the object was in the inventory and is removed, false otherwise.
+ */
+bool Player::removeObject(const ObjectValue *aObject)
+{
+    if (aObject < mInventory.data() || aObject >= mInventory.data() + mInventory.size())
+    {
+        return false;
     }
-    return nullptr;
+    removeSlot(static_cast<size_t>(aObject - mInventory.data()));
+    return true;
+}
+
+/**
+ * @brief Finds an object in the player's inventory by name.
+ * 
+ * @param aObjectName The name of the object.
+ * @return const ObjectValue* The object in the inventory, valid until the inventory changes, or nullptr if it was not found.
+ */
+const ObjectValue *Player::findObject(const char *aObjectName) const
+{
+    size_t slot = findSlot(aObjectName);
+    return slot == NoSlot ? nullptr : &mInventory[slot];
 }
 
 /**
@@ -266,9 +265,9 @@ void Player::toggleGodMode()
 /**
  * @brief Gets the player's inventory.
  * 
- * @return std::vector<std::unique_ptr<IGameObject>>& Reference to the vector of inventory items.
+ * @return const std::vector<ObjectValue>& Reference to the vector of inventory items.
  */
-std::vector<std::unique_ptr<IGameObject>> &Player::getInventory()
+const std::vector<ObjectValue> &Player::getInventory() const
 {
     return mInventory;
 }
@@ -301,11 +300,11 @@ int Player::getAttackPercentage() const
 int Player::getAttackDamage() const
 {
     RandomGenerator randomEngine;
-    if (mEquippedWeapon)
+    if (mEquippedWeapon != NoSlot)
     {
         if (randomEngine.getChance(mAttackPercentage) || mGodMode)
         {
-            return mEquippedWeapon->getValue();
+            return mInventory[mEquippedWeapon].getValue();
         }
     }
     return 0;
@@ -339,4 +338,115 @@ int Player::getGold() const
 std::string Player::getName() const
 {
     return mName;
+}
+
+// Private Methods
+
+/**
+ * @brief Finds the slot of an object in the player's inventory by name.
+ * 
+ * @param aObjectName The name of the object.
+ * @return size_t The slot of the object, or NoSlot if it was not found.
+ */
+size_t Player::findSlot(const char *aObjectName) const
+{
+    auto range = mInventoryIndex.equal_range(hashName(aObjectName, std::strlen(aObjectName)));
+    for (auto entry = range.first; entry != range.second; ++entry)
+    {
+        if (mInventory[entry->second].hasName(aObjectName))
+        {
+            return entry->second;
+        }
+    }
+    return NoSlot;
+}
+
+/**
+ * @brief Adds an object to a new slot at the end of the inventory and indexes it.
+ * 
+ * @param aObject The value of the object to add.
+ */
+void Player::addToSlot(const ObjectValue &aObject)
+{
+    Sean::String name = aObject.getName();
+    auto entry = mInventoryIndex.emplace(hashName(name.c_str(), name.size()), mInventory.size());
+    mInventoryEntries.push_back(&*entry);
+    mInventory.push_back(aObject);
+}
+
+/**
+ * @brief Removes the object in a slot from the inventory by moving the last object into the slot.
+ * 
+ * An equip slot that holds the object is cleared, an equip slot that holds the last object follows it.
+ * 
+ * @param aSlot The slot of the object.
+ * @return ObjectValue The removed object.
+ */
+ObjectValue Player::removeSlot(size_t aSlot)
+{
+    ObjectValue object = mInventory[aSlot];
+    InventoryIndex::value_type *removedEntry = mInventoryEntries[aSlot];
+    auto range = mInventoryIndex.equal_range(removedEntry->first);
+    for (auto entry = range.first; entry != range.second; ++entry)
+    {
+        if (&*entry == removedEntry)
+        {
+            mInventoryIndex.erase(entry);
+            break;
+        }
+    }
+    if (mEquippedWeapon == aSlot)
+    {
+        mEquippedWeapon = NoSlot;
+    }
+    if (mEquippedArmor == aSlot)
+    {
+        mEquippedArmor = NoSlot;
+    }
+
+    size_t last = mInventory.size() - 1;
+    if (aSlot != last)
+    {
+        mInventory[aSlot] = mInventory[last];
+        mInventoryEntries[aSlot] = mInventoryEntries[last];
+        mInventoryEntries[aSlot]->second = aSlot;
+        if (mEquippedWeapon == last)
+        {
+            mEquippedWeapon = aSlot;
+        }
+        if (mEquippedArmor == last)
+        {
+            mEquippedArmor = aSlot;
+        }
+    }
+    mInventory.pop_back();
+    mInventoryEntries.pop_back();
+    return object;
+}
+
+/**
+ * @brief Hashes the name of an inventory item for the name index.
+ * 
+ * @param aName The name of the item.
+ * @param aLength The length of the name.
+ * @return size_t The hash of the name.
+ */
+size_t Player::hashName(const char *aName, size_t aLength)
+{
+    return std::hash<std::string_view>()(std::string_view(aName, aLength));
+}
+
+/**
+ * @brief Rebuilds the name index after the inventory was replaced as a whole.
+ */
+void Player::indexInventory()
+{
+    mInventoryIndex.clear();
+    mInventoryEntries.clear();
+    for (size_t slot = 0; slot < mInventory.size(); ++slot)
+    {
+        Sean::String name = mInventory[slot].getName();
+        auto entry = mInventoryIndex.emplace(hashName(name.c_str(), name.size()), slot);
+        mInventoryEntries.push_back(&*entry);
+    }
 }
\ No newline at end of file
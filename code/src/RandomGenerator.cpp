@@ -1,19 +1,54 @@
 #include "RandomGenerator.h"
 
-// Initialize the static member
-std::default_random_engine RandomGenerator::mEngine{std::random_device{}()};
+#include <random>
+
+/**
+ * @brief Rotates a 64-bit value to the left.
+ *
+ * @param aValue The value to rotate.
+ * @param aBits The number of bits to rotate by.
+ * @return uint64_t The rotated value.
+ */
+static uint64_t rotateLeft(uint64_t aValue, int aBits)
+{
+    return (aValue << aBits) | (aValue >> (64 - aBits));
+}
+
+/**
+ * @brief Seeds the engine of the calling thread, so it gives the same values every run.
+ *
+ * @param aSeed The seed.
+ */
+void RandomGenerator::seed(uint64_t aSeed)
+{
+    seedEngine(getEngine(), aSeed);
+}
+
+/**
+ * @brief Gets a random 64-bit value.
+ *
+ * @return uint64_t The random value.
+ */
+uint64_t RandomGenerator::next()
+{
+    return nextValue(getEngine());
+}
 
 /**
  * @brief Gets a random value between aMin and aMax.
  * 
  * @param aMin The minimum value.
  * @param aMax The maximum value.
- * @return int The random value.
+ * @return int The random value, aMin if aMax is not above aMin.
  */
 int RandomGenerator::getRandomValue(int aMin, int aMax)
 {
-    std::uniform_int_distribution<int> distribution(aMin, aMax);
-    return distribution(mEngine);
+    if (aMax <= aMin)
+    {
+        return aMin;
+    }
+    uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(aMax) - aMin) + 1;
+    return static_cast<int>(aMin + static_cast<int64_t>(nextBelow(getEngine(), range)));
 }
 
 /**
@@ -28,6 +63,134 @@ bool RandomGenerator::getChance(int aPercent)
     {
         return false;
     }
-    std::uniform_int_distribution<int> distribution(1, 100);
-    return distribution(mEngine) <= aPercent;
+    return nextBelow(getEngine(), 100) < static_cast<uint64_t>(aPercent);
+}
+
+/**
+ * @brief Fills an array with random 64-bit values.
+ *
+ * @param aValues The array to fill.
+ * @param aCount The number of values.
+ */
+void RandomGenerator::fill(uint64_t *aValues, size_t aCount)
+{
+    Engine &engine = getEngine();
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        aValues[i] = nextValue(engine);
+    }
+}
+
+/**
+ * @brief Fills an array with random values between aMin and aMax.
+ *
+ * @param aValues The array to fill.
+ * @param aCount The number of values.
+ * @param aMin The minimum value.
+ * @param aMax The maximum value.
+ */
+void RandomGenerator::fillRandomValues(int *aValues, size_t aCount, int aMin, int aMax)
+{
+    if (aMax <= aMin)
+    {
+        for (size_t i = 0; i < aCount; ++i)
+        {
+            aValues[i] = aMin;
+        }
+        return;
+    }
+    Engine &engine = getEngine();
+    uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(aMax) - aMin) + 1;
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        aValues[i] = static_cast<int>(aMin + static_cast<int64_t>(nextBelow(engine, range)));
+    }
+}
+
+// Private Methods
+
+/**
+ * @brief Gets the engine of the calling thread, seeding it from the system on first use.
+ *
+ * @return Engine& The engine of the calling thread.
+ */
+RandomGenerator::Engine &RandomGenerator::getEngine()
+{
+    thread_local Engine engine = []()
+    {
+        Engine newEngine;
+        std::random_device device;
+        seedEngine(newEngine, (static_cast<uint64_t>(device()) << 32) ^ device());
+        return newEngine;
+    }();
+    return engine;
+}
+
+/**
+ * @brief Sets the state of an engine from a seed with SplitMix64, which never gives an all-zero state.
+ *
+ * @param aEngine The engine to seed.
+ * @param aSeed The seed.
+ */
+void RandomGenerator::seedEngine(Engine &aEngine, uint64_t aSeed)
+{
+    for (uint64_t &state : aEngine.mState)
+    {
+        aSeed += 0x9E3779B97F4A7C15ULL;
+        uint64_t value = aSeed;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        state = value ^ (value >> 31);
+    }
+}
+
+/**
+ * @brief Advances an engine and gets its next value (xoshiro256**).
+ *
+ * @param aEngine The engine.
+ * @return uint64_t The next value.
+ */
+uint64_t RandomGenerator::nextValue(Engine &aEngine)
+{
+    uint64_t *state = aEngine.mState;
+    uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+    uint64_t shifted = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = rotateLeft(state[3], 45);
+    return result;
+}
+
+/**
+ * @brief Gets an unbiased random value below a range of at most 2^32, without a distribution object.
+ *
+ * Uses the multiply-shift method: the 32 high bits of a value are scaled to the range, and the
+ * few values that would make some results more likely than others are rejected.
+ *
+ * @param aEngine The engine.
+ * @param aRange The number of possible values, between 1 and 2^32.
+ * @return uint64_t The random value, below aRange.
+ */
+uint64_t RandomGenerator::nextBelow(Engine &aEngine, uint64_t aRange)
+{
+    if (aRange > 0xFFFFFFFFULL)
+    {
+        return nextValue(aEngine) >> 32;
+    }
+    uint32_t range = static_cast<uint32_t>(aRange);
+    uint64_t product = (nextValue(aEngine) >> 32) * range;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < range)
+    {
+        uint32_t threshold = static_cast<uint32_t>(-range) % range;
+        while (low < threshold)
+        {
+            product = (nextValue(aEngine) >> 32) * range;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return product >> 32;
 }
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "RandomStream.h"
+
+/**
+ * @brief Mixes a 64-bit value into a well-distributed 64-bit value (SplitMix64 finalizer).
+ *
+ * @param aValue The value to mix.
+ * @return uint64_t The mixed value.
+ */
+static uint64_t mix(uint64_t aValue)
+{
+    aValue = (aValue ^ (aValue >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    aValue = (aValue ^ (aValue >> 27)) * 0x94D049BB133111EBULL;
+    return aValue ^ (aValue >> 31);
+}
+
+/**
+ * @brief Constructs the stream for a seed, stream and counter.
+ *
+ * @param aSeed The seed of the whole simulation.
+ * @param aStream The stream, for example an entity ID.
+ * @param aCounter The counter, for example a turn.
+ */
+RandomStream::RandomStream(uint64_t aSeed, uint64_t aStream, uint64_t aCounter)
+    : mState(mix(mix(aSeed ^ mix(aStream + 0x9E3779B97F4A7C15ULL)) + aCounter))
+{
+}
+
+/**
+ * @brief Gets the next raw value of the stream.
+ *
+ * @return uint64_t The next value.
+ */
+uint64_t RandomStream::next()
+{
+    mState += 0x9E3779B97F4A7C15ULL;
+    return mix(mState);
+}
+
+/**
+ * @brief Gets a random value between aMin and aMax.
+ *
+ * @param aMin The minimum value.
+ * @param aMax The maximum value.
+ * @return int The random value.
+ */
+int RandomStream::getRandomValue(int aMin, int aMax)
+{
+    if (aMax <= aMin)
+    {
+        return aMin;
+    }
+    uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(aMax) - aMin) + 1;
+    return aMin + static_cast<int>(next() % range);
+}
+
+/**
+ * @brief Gets a random chance based on a percentage.
+ *
+ * @param aPercent The percentage chance.
+ * @return bool True if the chance is successful, false otherwise.
+ */
+bool RandomStream::getChance(int aPercent)
+{
+    if (aPercent < 0 || aPercent > 100)
+    {
+        return false;
+    }
+    return getRandomValue(1, 100) <= aPercent;
+}
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include "RoomGraph.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Constructs the graph from the exits of a layout.
+ *
+ * @param aLayout The layout to take the exits from.
+ */
+RoomGraph::RoomGraph(const DungeonLayout &aLayout)
+{
+    size_t roomCount = aLayout.getRoomCount();
+    mExits.reserve(roomCount * ExitsPerRoom);
+    for (uint32_t room = 0; room < roomCount; ++room)
+    {
+        for (uint32_t direction = 0; direction < ExitsPerRoom; ++direction)
+        {
+            mExits.push_back(aLayout.getExit(room, static_cast<Sean::Direction>(direction)));
+        }
+    }
+    buildAdjacency();
+}
+
+/**
+ * @brief Constructs the graph from an array of exits, taking it over.
+ *
+ * @param aExits Room index per direction, ExitsPerRoom per room.
+ */
+RoomGraph::RoomGraph(std::vector<uint32_t> aExits)
+    : mExits(std::move(aExits))
+{
+    buildAdjacency();
+}
+
+/**
+ * @brief Gets the number of rooms.
+ *
+ * @return size_t The number of rooms.
+ */
+size_t RoomGraph::getRoomCount() const
+{
+    return mExits.size() / ExitsPerRoom;
+}
+
+/**
+ * @brief Gets the exit of a room in the given direction.
+ *
+ * @param aRoom The index of the room.
+ * @param aDirection The direction of the exit.
+ * @return uint32_t The index of the room the exit leads to, or NoRoom.
+ */
+uint32_t RoomGraph::getExit(uint32_t aRoom, Sean::Direction aDirection) const
+{
+    if (aDirection == Sean::Direction::Invalid)
+    {
+        return NoRoom;
+    }
+    return mExits[aRoom * ExitsPerRoom + static_cast<uint32_t>(aDirection)];
+}
+
+/**
+ * @brief Gets the rooms a room has an exit to.
+ *
+ * @param aRoom The index of the room.
+ * @return const uint32_t* The first of getNeighbourCount(aRoom) room indexes.
+ */
+const uint32_t *RoomGraph::getNeighbours(uint32_t aRoom) const
+{
+    if (!mChangedNeighbours.empty())
+    {
+        auto row = mChangedNeighbours.find(aRoom);
+        if (row != mChangedNeighbours.end())
+        {
+            return row->second.data();
+        }
+    }
+    return mNeighbours.data() + mNeighbourOffsets[aRoom];
+}
+
+/**
+ * @brief Gets the number of exits a room has.
+ *
+ * @param aRoom The index of the room.
+ * @return uint32_t The number of exits.
+ */
+uint32_t RoomGraph::getNeighbourCount(uint32_t aRoom) const
+{
+    if (!mChangedNeighbours.empty())
+    {
+        auto row = mChangedNeighbours.find(aRoom);
+        if (row != mChangedNeighbours.end())
+        {
+            return static_cast<uint32_t>(row->second.size());
+        }
+    }
+    return mNeighbourOffsets[aRoom + 1] - mNeighbourOffsets[aRoom];
+}
+
+/**
+ * @brief Gets the rooms that have an exit to a room.
+ *
+ * @param aRoom The index of the room.
+ * @return const uint32_t* The first of getPredecessorCount(aRoom) room indexes.
+ */
+const uint32_t *RoomGraph::getPredecessors(uint32_t aRoom) const
+{
+    if (!mChangedPredecessors.empty())
+    {
+        auto row = mChangedPredecessors.find(aRoom);
+        if (row != mChangedPredecessors.end())
+        {
+            return row->second.data();
+        }
+    }
+    return mPredecessors.data() + mPredecessorOffsets[aRoom];
+}
+
+/**
+ * @brief Gets the number of exits that lead to a room.
+ *
+ * @param aRoom The index of the room.
+ * @return uint32_t The number of exits.
+ */
+uint32_t RoomGraph::getPredecessorCount(uint32_t aRoom) const
+{
+    if (!mChangedPredecessors.empty())
+    {
+        auto row = mChangedPredecessors.find(aRoom);
+        if (row != mChangedPredecessors.end())
+        {
+            return static_cast<uint32_t>(row->second.size());
+        }
+    }
+    return mPredecessorOffsets[aRoom + 1] - mPredecessorOffsets[aRoom];
+}
+
+/**
+ * @brief Sets or removes the exit of a room in the given direction.
+ *
+ * Only the rows of the room and of the rooms the exit led and leads to are updated, in the overlay.
+ * The overlay is packed into the rows once it holds a sixteenth of the rooms, so a change costs
+ * constant time on average.
+ *
+ * @param aRoom The index of the room.
+ * @param aDirection The direction of the exit.
+ * @param aTarget The index of the room the exit leads to, or NoRoom to remove the exit.
+ * @throws std::out_of_range if a room or the direction is invalid.
+ */
+void RoomGraph::setExit(uint32_t aRoom, Sean::Direction aDirection, uint32_t aTarget)
+{
+    if (aRoom >= getRoomCount() || aDirection == Sean::Direction::Invalid || (aTarget != NoRoom && aTarget >= getRoomCount()))
+    {
+        throw std::out_of_range("Invalid exit");
+    }
+    uint32_t &exit = mExits[aRoom * ExitsPerRoom + static_cast<uint32_t>(aDirection)];
+    uint32_t previous = exit;
+    if (previous == aTarget)
+    {
+        return;
+    }
+    exit = aTarget;
+
+    // The neighbours stay in direction order, so the row is written again from the exits
+    std::vector<uint32_t> &neighbours = mChangedNeighbours[aRoom];
+    neighbours.clear();
+    for (uint32_t direction = 0; direction < ExitsPerRoom; ++direction)
+    {
+        uint32_t target = mExits[aRoom * ExitsPerRoom + direction];
+        if (target != NoRoom)
+        {
+            neighbours.push_back(target);
+        }
+    }
+
+    // A room with two exits to the same room is its predecessor twice, only one of them goes
+    if (previous != NoRoom)
+    {
+        std::vector<uint32_t> &predecessors = editPredecessors(previous);
+        predecessors.erase(std::find(predecessors.begin(), predecessors.end(), aRoom));
+    }
+    if (aTarget != NoRoom)
+    {
+        editPredecessors(aTarget).push_back(aRoom);
+    }
+
+    if (mChangedNeighbours.size() + mChangedPredecessors.size() > std::max<size_t>(64, getRoomCount() / 16))
+    {
+        buildAdjacency();
+    }
+}
+
+/**
+ * @brief Prints the exits of a room.
+ *
+ * @param aRoom The index of the room.
+ */
+void RoomGraph::printExits(uint32_t aRoom) const
+{
+    static const char *directionNames[ExitsPerRoom] = {"noord", "oost", "zuid", "west"};
+
+    std::cout << "Uitgangen: ";
+    for (uint32_t direction = 0; direction < ExitsPerRoom; ++direction)
+    {
+        if (mExits[aRoom * ExitsPerRoom + direction] != NoRoom)
+        {
+            std::cout << directionNames[direction] << " ";
+        }
+    }
+    std::cout << std::endl;
+}
+
+// Private Methods
+
+/**
+ * @brief Packs the existing exits per room, leaving and arriving, and empties the overlay.
+ */
+void RoomGraph::buildAdjacency()
+{
+    mChangedNeighbours.clear();
+    mChangedPredecessors.clear();
+
+    uint32_t roomCount = static_cast<uint32_t>(getRoomCount());
+    mNeighbourOffsets.assign(roomCount + 1, 0);
+    mPredecessorOffsets.assign(roomCount + 1, 0);
+    mNeighbours.clear();
+
+    for (uint32_t room = 0; room < roomCount; ++room)
+    {
+        mNeighbourOffsets[room] = static_cast<uint32_t>(mNeighbours.size());
+        for (uint32_t direction = 0; direction < ExitsPerRoom; ++direction)
+        {
+            uint32_t target = mExits[room * ExitsPerRoom + direction];
+            if (target != NoRoom)
+            {
+                mNeighbours.push_back(target);
+                ++mPredecessorOffsets[target + 1];
+            }
+        }
+    }
+    mNeighbourOffsets[roomCount] = static_cast<uint32_t>(mNeighbours.size());
+
+    // Count the exits arriving in each room, then fill them in place
+    for (uint32_t room = 0; room < roomCount; ++room)
+    {
+        mPredecessorOffsets[room + 1] += mPredecessorOffsets[room];
+    }
+    mPredecessors.resize(mNeighbours.size());
+    std::vector<uint32_t> next(mPredecessorOffsets.begin(), mPredecessorOffsets.end() - 1);
+    for (uint32_t room = 0; room < roomCount; ++room)
+    {
+        for (uint32_t i = mNeighbourOffsets[room]; i < mNeighbourOffsets[room + 1]; ++i)
+        {
+            mPredecessors[next[mNeighbours[i]]++] = room;
+        }
+    }
+}
+
+/**
+ * @brief Gets the predecessors of a room in the overlay to change them, copying the packed row first.
+ *
+ * @param aRoom The index of the room.
+ * @return std::vector<uint32_t>& The predecessors of the room.
+ */
+std::vector<uint32_t> &RoomGraph::editPredecessors(uint32_t aRoom)
+{
+    auto row = mChangedPredecessors.find(aRoom);
+    if (row != mChangedPredecessors.end())
+    {
+        return row->second;
+    }
+    const uint32_t *packed = mPredecessors.data() + mPredecessorOffsets[aRoom];
+    return mChangedPredecessors.emplace(aRoom, std::vector<uint32_t>(packed, packed + mPredecessorOffsets[aRoom + 1] - mPredecessorOffsets[aRoom])).first->second;
+}
\ No newline at end of file
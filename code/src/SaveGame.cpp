@@ -0,0 +1,518 @@
+#include "SaveGame.h"
+#include "BinaryFormat.h"
+#include "MappedFile.h"
+#include "GameObject.h"
+#include "ObjectValue.h"
+#include "GameObjectFactory.h"
+#include "EnemyFactory.h"
+#include "LootTables.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Appends raw bytes to a snapshot.
+ *
+ * @param aBuffer The snapshot.
+ * @param aData The bytes to append.
+ * @param aSize The number of bytes.
+ */
+static void putBytes(std::vector<char> &aBuffer, const void *aData, size_t aSize)
+{
+    const char *bytes = static_cast<const char *>(aData);
+    aBuffer.insert(aBuffer.end(), bytes, bytes + aSize);
+}
+
+/**
+ * @brief Appends a value to a snapshot.
+ *
+ * @param aBuffer The snapshot.
+ * @param aValue The value to append.
+ */
+template <typename T>
+static void putValue(std::vector<char> &aBuffer, const T &aValue)
+{
+    putBytes(aBuffer, &aValue, sizeof(T));
+}
+
+/**
+ * @brief Appends a string to a snapshot as its length followed by its characters.
+ *
+ * @param aBuffer The snapshot.
+ * @param aText The string to append.
+ */
+static void putString(std::vector<char> &aBuffer, const char *aText)
+{
+    uint32_t length = static_cast<uint32_t>(strlen(aText));
+    putValue(aBuffer, length);
+    putBytes(aBuffer, aText, length);
+}
+
+/**
+ * @brief Read position in a mapped saved game.
+ */
+struct SaveCursor
+{
+    const char *mData; ///< Start of the saved game.
+    size_t mSize;      ///< Size of the saved game.
+    size_t mOffset;    ///< Current read position.
+
+    /**
+     * @brief Copies bytes out of the saved game and advances the read position.
+     *
+     * @param aTarget Where to copy the bytes to.
+     * @param aSize The number of bytes.
+     * @throws std::runtime_error if the saved game ends too early.
+     */
+    void getBytes(void *aTarget, size_t aSize)
+    {
+        if (aSize > mSize - mOffset)
+        {
+            throw std::runtime_error("Invalid save file: truncated");
+        }
+        if (aSize > 0)
+        {
+            memcpy(aTarget, mData + mOffset, aSize);
+        }
+        mOffset += aSize;
+    }
+
+    /**
+     * @brief Reads a value.
+     *
+     * @return T The value.
+     * @throws std::runtime_error if the saved game ends too early.
+     */
+    template <typename T>
+    T getValue()
+    {
+        T value;
+        getBytes(&value, sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Reads an array of values.
+     *
+     * @param aTarget The vector to fill.
+     * @param aCount The number of values.
+     * @throws std::runtime_error if the saved game ends too early.
+     */
+    template <typename T>
+    void getArray(std::vector<T> &aTarget, size_t aCount)
+    {
+        if (aCount > (mSize - mOffset) / sizeof(T))
+        {
+            throw std::runtime_error("Invalid save file: truncated");
+        }
+        aTarget.resize(aCount);
+        getBytes(aTarget.data(), aCount * sizeof(T));
+    }
+
+    /**
+     * @brief Reads a string stored as its length followed by its characters.
+     *
+     * @return std::string The string.
+     * @throws std::runtime_error if the saved game ends too early.
+     */
+    std::string getString()
+    {
+        uint32_t length = getValue<uint32_t>();
+        if (length > mSize - mOffset)
+        {
+            throw std::runtime_error("Invalid save file: truncated");
+        }
+        std::string text(mData + mOffset, length);
+        mOffset += length;
+        return text;
+    }
+
+    /**
+     * @brief Reads an object as a value.
+     *
+     * @return ObjectValue The object.
+     * @throws std::runtime_error if the saved game ends too early or the object type is unknown.
+     */
+    ObjectValue getObjectValue()
+    {
+        BinaryFormat::ObjectRecord record = getValue<BinaryFormat::ObjectRecord>();
+        Sean::String name(getString().c_str());
+        Sean::String description(getString().c_str());
+        if (record.mType > static_cast<uint32_t>(ObjectType::Consumable_Teleport))
+        {
+            throw std::runtime_error("Invalid save file: unknown object type");
+        }
+        GameObjectFactory::raiseCounter(record.mId);
+        uint32_t objectTemplate = ObjectTemplates::getInstance().intern(name, description, static_cast<ObjectType>(record.mType), record.mMinimum, record.mMaximum);
+        return ObjectValue(objectTemplate, record.mId);
+    }
+
+    /**
+     * @brief Reads a list of objects stored as its size followed by the objects.
+     *
+     * @param aObjects The list to add the objects to.
+     * @throws std::runtime_error if the saved game ends too early or an object type is unknown.
+     */
+    void getObjectValues(Sean::Vector<ObjectValue> &aObjects)
+    {
+        uint32_t count = getValue<uint32_t>();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            aObjects.push_back(getObjectValue());
+        }
+    }
+};
+
+/**
+ * @brief Constructs a SaveGame for the given path.
+ *
+ * @param aPath The path of the saved game.
+ */
+SaveGame::SaveGame(const char *aPath)
+    : mPath(aPath)
+{
+}
+
+/**
+ * @brief Saves the dungeon and the player, replacing any existing file.
+ *
+ * @param aDungeon The dungeon to save.
+ * @param aPlayer The player to save.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void SaveGame::save(const Dungeon &aDungeon, const Player &aPlayer) const
+{
+    const DungeonLayout &layout = *aDungeon.mLayout;
+    const RoomGraph &graph = *aDungeon.mGraph;
+    const EntityStore &entities = aDungeon.mEntities;
+    size_t padding = (4 - layout.mAtomChars.size() % 4) % 4;
+
+    // Rooms with enemies in order, so saving the same game twice gives the same file
+    std::vector<uint32_t> indexedRooms;
+    indexedRooms.reserve(entities.mRoomIndex.size());
+    for (const auto &room : entities.mRoomIndex)
+    {
+        indexedRooms.push_back(room.first);
+    }
+    std::sort(indexedRooms.begin(), indexedRooms.end());
+    std::vector<uint32_t> materializedRooms;
+    materializedRooms.reserve(aDungeon.mMap.size());
+    for (const auto &room : aDungeon.mMap)
+    {
+        materializedRooms.push_back(room.first);
+    }
+    std::sort(materializedRooms.begin(), materializedRooms.end());
+    std::vector<uint32_t> touchedRooms(aDungeon.mTouchedRooms.begin(), aDungeon.mTouchedRooms.end());
+    std::sort(touchedRooms.begin(), touchedRooms.end());
+
+    BinaryFormat::SaveHeader header{};
+    memcpy(header.mMagic, BinaryFormat::SaveMagic, sizeof(header.mMagic));
+    header.mVersion = BinaryFormat::SaveVersion;
+    header.mLayout.mRoomCount = static_cast<uint32_t>(layout.mRooms.size());
+    header.mLayout.mAtomCount = static_cast<uint32_t>(layout.mAtomOffsets.size());
+    header.mLayout.mCharCount = static_cast<uint32_t>(layout.mAtomChars.size() + padding);
+    header.mLayout.mListCount = static_cast<uint32_t>(layout.mLists.size());
+    header.mSeed = aDungeon.mScheduler.getSeed();
+    header.mTurn = aDungeon.mTurn;
+    header.mCurrentRoom = aDungeon.mCurrentRoom;
+    header.mMaterializeRadius = aDungeon.mMaterializeRadius;
+    header.mActiveSimulation = aDungeon.mActiveSimulation ? 1 : 0;
+    header.mTouchedCount = static_cast<uint32_t>(touchedRooms.size());
+    header.mEntityCount = static_cast<uint32_t>(entities.getEntityCount());
+    header.mRoomIndexCount = static_cast<uint32_t>(indexedRooms.size());
+    header.mLocationCount = static_cast<uint32_t>(materializedRooms.size());
+    header.mInventoryCount = static_cast<uint32_t>(aPlayer.mInventory.size());
+
+    std::vector<char> buffer;
+    buffer.reserve(sizeof(header) + layout.mAtomOffsets.size() * sizeof(uint32_t) + layout.mAtomChars.size() + padding +
+                   layout.mRooms.size() * (sizeof(DungeonLayout::Room) + DungeonLayout::ExitsPerRoom * sizeof(uint32_t) + 1) +
+                   layout.mLists.size() * sizeof(uint32_t));
+
+    const char zeros[4] = {0, 0, 0, 0};
+    putValue(buffer, header);
+    putBytes(buffer, layout.mAtomOffsets.data(), layout.mAtomOffsets.size() * sizeof(uint32_t));
+    putBytes(buffer, layout.mAtomChars.data(), layout.mAtomChars.size());
+    putBytes(buffer, zeros, padding);
+    putBytes(buffer, layout.mRooms.data(), layout.mRooms.size() * sizeof(DungeonLayout::Room));
+    putBytes(buffer, graph.mExits.data(), graph.mExits.size() * sizeof(uint32_t));
+    putBytes(buffer, layout.mLists.data(), layout.mLists.size() * sizeof(uint32_t));
+
+    for (bool spawned : aDungeon.mSpawnedRooms)
+    {
+        buffer.push_back(spawned ? 1 : 0);
+    }
+    putBytes(buffer, touchedRooms.data(), touchedRooms.size() * sizeof(uint32_t));
+
+    for (EntityStore::EntityId entity = 0; entity < header.mEntityCount; ++entity)
+    {
+        BinaryFormat::EntityRecord record;
+        record.mNumber = entities.mNumbers[entity];
+        record.mHealth = entities.mHealth[entity];
+        record.mAttackPercent = entities.mAttackStats[entity].mAttackPercent;
+        record.mMinimumDamage = entities.mAttackStats[entity].mMinimumDamage;
+        record.mMaximumDamage = entities.mAttackStats[entity].mMaximumDamage;
+        record.mPosition = entities.mPositions[entity];
+        record.mLastSimulated = entities.mLastSimulated[entity];
+        record.mLootSeed = entities.mLootSeeds[entity];
+        record.mLootPending = entities.mLootTables[entity] != LootTables::NoLoot ? 1 : 0;
+        putValue(buffer, record);
+        putString(buffer, EnemyFactory::getKindName(entities.mKinds[entity]).c_str());
+    }
+    for (uint32_t room : indexedRooms)
+    {
+        const std::vector<EntityStore::EntityId> &roomEntities = entities.mRoomIndex.at(room);
+        putValue(buffer, room);
+        putValue(buffer, static_cast<uint32_t>(roomEntities.size()));
+        putBytes(buffer, roomEntities.data(), roomEntities.size() * sizeof(EntityStore::EntityId));
+    }
+
+    for (uint32_t room : materializedRooms)
+    {
+        const Location &location = *aDungeon.mMap.at(room);
+        putValue(buffer, room);
+        putObjects(buffer, location.getVisibleObjects().begin(), static_cast<uint32_t>(location.getVisibleObjects().size()));
+        putObjects(buffer, location.getHiddenObjects().begin(), static_cast<uint32_t>(location.getHiddenObjects().size()));
+    }
+
+    BinaryFormat::PlayerRecord player;
+    player.mHealth = aPlayer.mHealth;
+    player.mAttackPercentage = aPlayer.mAttackPercentage;
+    player.mGold = aPlayer.mGold;
+    player.mGodMode = aPlayer.mGodMode ? 1 : 0;
+    player.mEquippedWeapon = aPlayer.mEquippedWeapon != Player::NoSlot ? static_cast<uint32_t>(aPlayer.mEquippedWeapon) : BinaryFormat::NoIndex;
+    player.mEquippedArmor = aPlayer.mEquippedArmor != Player::NoSlot ? static_cast<uint32_t>(aPlayer.mEquippedArmor) : BinaryFormat::NoIndex;
+    putValue(buffer, player);
+    putString(buffer, aPlayer.mName.c_str());
+    for (const ObjectValue &item : aPlayer.mInventory)
+    {
+        putObject(buffer, item);
+    }
+
+    std::ofstream file(mPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Failed to open file: " + mPath);
+    }
+    file.write(buffer.data(), buffer.size());
+    if (!file.good())
+    {
+        throw std::runtime_error("Failed to write file: " + mPath);
+    }
+}
+
+/**
+ * @brief Loads a saved game.
+ *
+ * The player is only changed once the whole file has been read, so a broken file leaves the
+ * current game untouched.
+ *
+ * @param aPlayer The player to restore.
+ * @return std::unique_ptr<Dungeon> The restored dungeon.
+ * @throws std::runtime_error if the file cannot be read or is not a valid saved game.
+ */
+std::unique_ptr<Dungeon> SaveGame::load(Player &aPlayer) const
+{
+    MappedFile file(mPath.c_str());
+    SaveCursor cursor{file.getData(), file.getSize(), 0};
+
+    BinaryFormat::SaveHeader header = cursor.getValue<BinaryFormat::SaveHeader>();
+    if (memcmp(header.mMagic, BinaryFormat::SaveMagic, sizeof(header.mMagic)) != 0)
+    {
+        throw std::runtime_error("Invalid save file: wrong magic");
+    }
+    if (header.mVersion != BinaryFormat::SaveVersion)
+    {
+        throw std::runtime_error("Invalid save file: unsupported version " + std::to_string(header.mVersion));
+    }
+    uint32_t roomCount = header.mLayout.mRoomCount;
+    if (roomCount == 0 || header.mCurrentRoom >= roomCount)
+    {
+        throw std::runtime_error("Invalid save file: room out of range");
+    }
+
+    std::unique_ptr<Dungeon> dungeon(new Dungeon());
+    std::shared_ptr<DungeonLayout> loadedLayout = std::make_shared<DungeonLayout>();
+    DungeonLayout &layout = *loadedLayout;
+    cursor.getArray(layout.mAtomOffsets, header.mLayout.mAtomCount);
+    cursor.getArray(layout.mAtomChars, header.mLayout.mCharCount);
+    cursor.getArray(layout.mRooms, roomCount);
+    cursor.getArray(layout.mExits, size_t(roomCount) * DungeonLayout::ExitsPerRoom);
+    cursor.getArray(layout.mLists, header.mLayout.mListCount);
+    layout.checkIndexes("Invalid save file");
+    layout.indexNames();
+    dungeon->mGraph = std::make_shared<RoomGraph>(layout.takeExits());
+    dungeon->mLayout = loadedLayout;
+
+    std::vector<uint8_t> spawned;
+    cursor.getArray(spawned, roomCount);
+    dungeon->mSpawnedRooms.assign(spawned.begin(), spawned.end());
+    std::vector<uint32_t> touchedRooms;
+    cursor.getArray(touchedRooms, header.mTouchedCount);
+    for (uint32_t room : touchedRooms)
+    {
+        if (room >= roomCount)
+        {
+            throw std::runtime_error("Invalid save file: room out of range");
+        }
+        dungeon->mTouchedRooms.insert(room);
+    }
+
+    EntityStore &entities = dungeon->mEntities;
+    for (uint32_t entity = 0; entity < header.mEntityCount; ++entity)
+    {
+        BinaryFormat::EntityRecord record = cursor.getValue<BinaryFormat::EntityRecord>();
+        if (record.mPosition >= roomCount)
+        {
+            throw std::runtime_error("Invalid save file: room out of range");
+        }
+        uint32_t kind = EnemyFactory::findKind(cursor.getString().c_str());
+        if (kind == EnemyFactory::NoKind)
+        {
+            throw std::runtime_error("Invalid save file: unknown enemy");
+        }
+        entities.mKinds.push_back(kind);
+        entities.mNumbers.push_back(record.mNumber);
+        entities.mHealth.push_back(record.mHealth);
+        entities.mAttackStats.push_back({record.mAttackPercent, record.mMinimumDamage, record.mMaximumDamage});
+        entities.mPositions.push_back(record.mPosition);
+        entities.mLastSimulated.push_back(record.mLastSimulated);
+        entities.mLootTables.push_back(record.mLootPending != 0 ? LootTables::getInstance().find(EnemyFactory::getKindName(kind)) : LootTables::NoLoot);
+        entities.mLootSeeds.push_back(record.mLootSeed);
+        EnemyFactory::raiseCounter(record.mNumber);
+    }
+    for (uint32_t i = 0; i < header.mRoomIndexCount; ++i)
+    {
+        uint32_t room = cursor.getValue<uint32_t>();
+        std::vector<EntityStore::EntityId> roomEntities;
+        cursor.getArray(roomEntities, cursor.getValue<uint32_t>());
+        for (EntityStore::EntityId entity : roomEntities)
+        {
+            if (entity >= header.mEntityCount || entities.mPositions[entity] != room)
+            {
+                throw std::runtime_error("Invalid save file: entity out of range");
+            }
+        }
+        entities.mRoomIndex[room] = std::move(roomEntities);
+    }
+
+    for (uint32_t i = 0; i < header.mLocationCount; ++i)
+    {
+        uint32_t room = cursor.getValue<uint32_t>();
+        if (room >= roomCount)
+        {
+            throw std::runtime_error("Invalid save file: room out of range");
+        }
+        const DungeonLayout::Room &layoutRoom = layout.getRoom(room);
+        std::shared_ptr<Location> location(new Location(layout.getAtom(layoutRoom.mName), layout.getAtom(layoutRoom.mDescription), layoutRoom.mId));
+        Sean::Vector<ObjectValue> objects;
+        cursor.getObjectValues(objects);
+        for (const ObjectValue &object : objects)
+        {
+            location->addVisibleObject(object);
+        }
+        Sean::Vector<ObjectValue> hiddenObjects;
+        cursor.getObjectValues(hiddenObjects);
+        for (const ObjectValue &object : hiddenObjects)
+        {
+            location->addHiddenObject(object);
+        }
+        dungeon->mMap.emplace(room, std::move(location));
+    }
+    if (dungeon->mMap.find(header.mCurrentRoom) == dungeon->mMap.end())
+    {
+        throw std::runtime_error("Invalid save file: current location missing");
+    }
+
+    BinaryFormat::PlayerRecord player = cursor.getValue<BinaryFormat::PlayerRecord>();
+    std::string playerName = cursor.getString();
+    std::vector<ObjectValue> inventory;
+    for (uint32_t i = 0; i < header.mInventoryCount; ++i)
+    {
+        inventory.push_back(cursor.getObjectValue());
+    }
+    if ((player.mEquippedWeapon != BinaryFormat::NoIndex && player.mEquippedWeapon >= inventory.size()) ||
+        (player.mEquippedArmor != BinaryFormat::NoIndex && player.mEquippedArmor >= inventory.size()))
+    {
+        throw std::runtime_error("Invalid save file: equipment out of range");
+    }
+    if (cursor.mOffset != cursor.mSize)
+    {
+        throw std::runtime_error("Invalid save file: size mismatch");
+    }
+
+    dungeon->mScheduler.setSeed(header.mSeed);
+    dungeon->mTurn = header.mTurn;
+    dungeon->mMaterializeRadius = header.mMaterializeRadius;
+    dungeon->mActiveSimulation = header.mActiveSimulation != 0;
+    dungeon->mCurrentRoom = header.mCurrentRoom;
+    dungeon->mCurrentLocation = dungeon->mMap.at(header.mCurrentRoom).get();
+    dungeon->updateRegion();
+
+    aPlayer.mName = playerName;
+    aPlayer.mHealth = player.mHealth;
+    aPlayer.mAttackPercentage = player.mAttackPercentage;
+    aPlayer.mGold = player.mGold;
+    aPlayer.mGodMode = player.mGodMode != 0;
+    aPlayer.mEquippedWeapon = player.mEquippedWeapon != BinaryFormat::NoIndex ? player.mEquippedWeapon : Player::NoSlot;
+    aPlayer.mEquippedArmor = player.mEquippedArmor != BinaryFormat::NoIndex ? player.mEquippedArmor : Player::NoSlot;
+    aPlayer.mInventory = std::move(inventory);
+    aPlayer.indexInventory();
+    return dungeon;
+}
+
+/**
+ * @brief Checks whether a file starts with the saved game magic.
+ *
+ * @param aPath The path to the file.
+ * @return bool True if the file is a saved game, false otherwise.
+ */
+bool SaveGame::isSaveFile(const char *aPath)
+{
+    std::ifstream file(aPath, std::ios_base::in | std::ios_base::binary);
+    char magic[sizeof(BinaryFormat::SaveMagic)];
+    if (!file.read(magic, sizeof(magic)))
+    {
+        return false;
+    }
+    return memcmp(magic, BinaryFormat::SaveMagic, sizeof(magic)) == 0;
+}
+
+// Private Methods
+
+/**
+ * @brief Appends an object to a snapshot.
+ *
+ * @param aBuffer The snapshot.
+ * @param aObject The object to append.
+ */
+void SaveGame::putObject(std::vector<char> &aBuffer, const ObjectValue &aObject)
+{
+    const ObjectTemplates::Template &objectTemplate = aObject.getTemplate();
+    BinaryFormat::ObjectRecord record;
+    record.mType = static_cast<uint32_t>(aObject.getType());
+    record.mId = aObject.getID();
+    record.mMinimum = objectTemplate.mMinimum;
+    record.mMaximum = objectTemplate.mMaximum;
+    putValue(aBuffer, record);
+    putString(aBuffer, objectTemplate.mName.c_str());
+    putString(aBuffer, objectTemplate.mDescription.c_str());
+}
+
+/**
+ * @brief Appends a range of object values to a snapshot as its size followed by the objects.
+ *
+ * @param aBuffer The snapshot.
+ * @param aObjects The first object value.
+ * @param aCount The number of object values.
+ */
+void SaveGame::putObjects(std::vector<char> &aBuffer, const ObjectValue *aObjects, uint32_t aCount)
+{
+    putValue(aBuffer, aCount);
+    for (uint32_t i = 0; i < aCount; ++i)
+    {
+        putObject(aBuffer, aObjects[i]);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "SessionRecorder.h"
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Starts a recorded session, replacing any existing file.
+ *
+ * @param aPath The path of the recorded session.
+ * @param aSeed The seed the RandomGenerator was given for the session.
+ * @param aInputBuf The buffer the input of the game is read from.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+SessionRecorder::SessionRecorder(const char *aPath, uint64_t aSeed, std::streambuf *aInputBuf)
+    : mPath(aPath), mFile(aPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc), mInputBuf(*this, aInputBuf)
+{
+    if (!mFile.is_open())
+    {
+        throw std::runtime_error("Failed to open file: " + mPath);
+    }
+
+    BinaryFormat::SessionHeader header;
+    memcpy(header.mMagic, BinaryFormat::SessionMagic, sizeof(header.mMagic));
+    header.mVersion = BinaryFormat::SessionVersion;
+    header.mSeed = aSeed;
+    mFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    mFile.flush();
+    if (!mFile.good())
+    {
+        throw std::runtime_error("Failed to write file: " + mPath);
+    }
+}
+
+/**
+ * @brief Ends the recorded session, writing the input of an unfinished line.
+ */
+SessionRecorder::~SessionRecorder()
+{
+    if (!mPendingInput.empty())
+    {
+        writeRecord(BinaryFormat::SessionRecord::Input, mPendingInput);
+    }
+}
+
+/**
+ * @brief Records the dungeon the session is played in.
+ *
+ * @param aSource The kind of dungeon.
+ * @param aText The path of the loaded dungeon or the number of generated locations.
+ */
+void SessionRecorder::recordSource(BinaryFormat::SessionSource aSource, const std::string &aText)
+{
+    writeRecord(BinaryFormat::SessionRecord::Source, static_cast<char>(aSource) + aText);
+}
+
+/**
+ * @brief Gets the buffer the game should read its input from while it is recorded.
+ *
+ * @return std::streambuf* The buffer, owned by the recorder.
+ */
+std::streambuf *SessionRecorder::getInputBuf()
+{
+    return &mInputBuf;
+}
+
+/**
+ * @brief Records a character of input, writing the line once it is complete.
+ *
+ * @param aCharacter The character that was read.
+ */
+void SessionRecorder::recordInput(char aCharacter)
+{
+    mPendingInput.push_back(aCharacter);
+    if (aCharacter == '\n')
+    {
+        writeRecord(BinaryFormat::SessionRecord::Input, mPendingInput);
+        mPendingInput.clear();
+    }
+}
+
+/**
+ * @brief Appends a record to the file and flushes it, so it survives the game being killed.
+ *
+ * Write errors are reported once on std::cerr, a broken recording does not stop the game.
+ *
+ * @param aRecord The kind of record.
+ * @param aData The contents of the record.
+ */
+void SessionRecorder::writeRecord(BinaryFormat::SessionRecord aRecord, const std::string &aData)
+{
+    if (!mFile.good())
+    {
+        return;
+    }
+    uint8_t record = static_cast<uint8_t>(aRecord);
+    uint32_t size = static_cast<uint32_t>(aData.size());
+    mFile.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    mFile.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    mFile.write(aData.data(), aData.size());
+    mFile.flush();
+    if (!mFile.good())
+    {
+        std::cerr << "Failed to write file: " << mPath << std::endl;
+    }
+}
+
+/**
+ * @brief Constructs a buffer that records the input read from another buffer.
+ *
+ * @param aRecorder The recorder to record the input with.
+ * @param aInputBuf The buffer the input is read from.
+ */
+SessionRecorder::RecordingBuf::RecordingBuf(SessionRecorder &aRecorder, std::streambuf *aInputBuf)
+    : mRecorder(aRecorder), mInputBuf(aInputBuf)
+{
+}
+
+/**
+ * @brief Reads a character and records it.
+ *
+ * @return int The character, or EOF at the end of the input.
+ */
+int SessionRecorder::RecordingBuf::uflow()
+{
+    int ch = mInputBuf->sbumpc();
+    if (ch != EOF)
+    {
+        mRecorder.recordInput(static_cast<char>(ch));
+    }
+    return ch;
+}
+
+/**
+ * @brief Peeks the next character without recording it.
+ *
+ * @return int The character, or EOF at the end of the input.
+ */
+int SessionRecorder::RecordingBuf::underflow()
+{
+    return mInputBuf->sgetc();
+}
\ No newline at end of file
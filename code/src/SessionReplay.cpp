@@ -0,0 +1,124 @@
+#include "SessionReplay.h"
+#include "MappedFile.h"
+
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * @brief Reads a recorded session.
+ *
+ * A session that ends in the middle of a record, because the game was killed while it was
+ * written, is replayed up to the last complete record.
+ *
+ * @param aPath The path of the recorded session.
+ * @throws std::runtime_error if the file cannot be read or is not a recorded session.
+ */
+SessionReplay::SessionReplay(const char *aPath)
+    : mSeed(0), mSource(BinaryFormat::SessionSource::None), mInputCount(0)
+{
+    MappedFile file(aPath);
+    const char *data = file.getData();
+    size_t size = file.getSize();
+
+    BinaryFormat::SessionHeader header;
+    if (size < sizeof(header))
+    {
+        throw std::runtime_error("Invalid session file: truncated");
+    }
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.mMagic, BinaryFormat::SessionMagic, sizeof(header.mMagic)) != 0)
+    {
+        throw std::runtime_error("Invalid session file: wrong magic");
+    }
+    if (header.mVersion != BinaryFormat::SessionVersion)
+    {
+        throw std::runtime_error("Invalid session file: unsupported version " + std::to_string(header.mVersion));
+    }
+    mSeed = header.mSeed;
+
+    std::string input;
+    size_t offset = sizeof(header);
+    while (size - offset >= sizeof(uint8_t) + sizeof(uint32_t))
+    {
+        uint8_t record;
+        uint32_t recordSize;
+        memcpy(&record, data + offset, sizeof(record));
+        memcpy(&recordSize, data + offset + sizeof(record), sizeof(recordSize));
+        offset += sizeof(record) + sizeof(recordSize);
+        if (recordSize > size - offset)
+        {
+            break;
+        }
+
+        const char *contents = data + offset;
+        offset += recordSize;
+        switch (static_cast<BinaryFormat::SessionRecord>(record))
+        {
+        case BinaryFormat::SessionRecord::Source:
+            if (recordSize == 0)
+            {
+                throw std::runtime_error("Invalid session file: empty source");
+            }
+            mSource = static_cast<BinaryFormat::SessionSource>(contents[0]);
+            mSourceText.assign(contents + 1, recordSize - 1);
+            break;
+        case BinaryFormat::SessionRecord::Input:
+            input.append(contents, recordSize);
+            ++mInputCount;
+            break;
+        default:
+            throw std::runtime_error("Invalid session file: unknown record " + std::to_string(record));
+        }
+    }
+    mInputBuf.str(input);
+}
+
+/**
+ * @brief Gets the seed the RandomGenerator was given for the session.
+ *
+ * @return uint64_t The seed.
+ */
+uint64_t SessionReplay::getSeed() const
+{
+    return mSeed;
+}
+
+/**
+ * @brief Gets the kind of dungeon the session was played in.
+ *
+ * @return BinaryFormat::SessionSource The kind of dungeon, None if no dungeon was chosen.
+ */
+BinaryFormat::SessionSource SessionReplay::getSource() const
+{
+    return mSource;
+}
+
+/**
+ * @brief Gets the path of the loaded dungeon or the number of generated locations.
+ *
+ * @return const std::string& The source of the dungeon, empty if no dungeon was chosen.
+ */
+const std::string &SessionReplay::getSourceText() const
+{
+    return mSourceText;
+}
+
+/**
+ * @brief Gets the number of recorded input lines.
+ *
+ * @return size_t The number of lines.
+ */
+size_t SessionReplay::getInputCount() const
+{
+    return mInputCount;
+}
+
+/**
+ * @brief Gets the buffer the game should read its input from to replay the session.
+ *
+ * @return std::streambuf* The buffer, owned by the replay.
+ */
+std::streambuf *SessionReplay::getInputBuf()
+{
+    return &mInputBuf;
+}
\ No newline at end of file
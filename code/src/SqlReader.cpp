@@ -349,6 +349,172 @@ bool SQLReader::getHighscore(Sean::String &aName, int &aScore, int aRank) const
     return found;
 }
 
+/**
+ * @brief Retrieves all locations from the database in one query.
+ *
+ * @param aNames The names of the locations.
+ * @param aDescriptions The descriptions of the locations, in the same order.
+ * @return bool True if at least one location was retrieved, false otherwise.
+ */
+bool SQLReader::getAllLocations(Sean::Vector<Sean::String> &aNames, Sean::Vector<Sean::String> &aDescriptions) const
+{
+    std::string query = "SELECT naam, beschrijving FROM Locaties ORDER BY naam";
+    sqlite3_stmt *stmt;
+    if (!prepareAndBindStatement(query, &stmt, nullptr))
+    {
+        return false;
+    }
+
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        aNames.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+        aDescriptions.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1)));
+    }
+
+    sqlite3_finalize(stmt);
+    return !aNames.empty();
+}
+
+/**
+ * @brief Retrieves the names of all enemies from the database in one query.
+ *
+ * @param aNames The names of the enemies.
+ * @return bool True if at least one enemy was retrieved, false otherwise.
+ */
+bool SQLReader::getAllEnemyNames(Sean::Vector<Sean::String> &aNames) const
+{
+    std::string query = "SELECT naam FROM Vijanden ORDER BY naam";
+    sqlite3_stmt *stmt;
+    if (!prepareAndBindStatement(query, &stmt, nullptr))
+    {
+        return false;
+    }
+
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        aNames.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+    }
+
+    sqlite3_finalize(stmt);
+    return !aNames.empty();
+}
+
+/**
+ * @brief Retrieves the names of all objects from the database in one query.
+ *
+ * @param aNames The names of the objects.
+ * @return bool True if at least one object was retrieved, false otherwise.
+ */
+bool SQLReader::getAllObjectNames(Sean::Vector<Sean::String> &aNames) const
+{
+    std::string query = "SELECT naam FROM Objecten ORDER BY naam";
+    sqlite3_stmt *stmt;
+    if (!prepareAndBindStatement(query, &stmt, nullptr))
+    {
+        return false;
+    }
+
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        aNames.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+    }
+
+    sqlite3_finalize(stmt);
+    return !aNames.empty();
+}
+
+/**
+ * @brief Retrieves the names of all object types from the database in one query.
+ *
+ * @param aNames The names of the object types.
+ * @return bool True if at least one object type was retrieved, false otherwise.
+ */
+bool SQLReader::getAllObjectTypes(Sean::Vector<Sean::String> &aNames) const
+{
+    std::string query = "SELECT naam FROM Objecttypen ORDER BY naam";
+    sqlite3_stmt *stmt;
+    if (!prepareAndBindStatement(query, &stmt, nullptr))
+    {
+        return false;
+    }
+
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        aNames.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+    }
+
+    sqlite3_finalize(stmt);
+    return !aNames.empty();
+}
+
+/**
+ * @brief Retrieves all enemies from the database in one query.
+ *
+ * @param aNames The names of the enemies.
+ * @param aDescriptions The descriptions of the enemies.
+ * @param aHealths The health of the enemies.
+ * @param aAttackPercents The attack percentages of the enemies.
+ * @param aMinDamages The minimum damage of the enemies.
+ * @param aMaxDamages The maximum damage of the enemies.
+ * @return bool True if at least one enemy was retrieved, false otherwise.
+ */
+bool SQLReader::getAllEnemies(Sean::Vector<Sean::String> &aNames, Sean::Vector<Sean::String> &aDescriptions, Sean::Vector<int> &aHealths, Sean::Vector<int> &aAttackPercents, Sean::Vector<int> &aMinDamages, Sean::Vector<int> &aMaxDamages) const
+{
+    std::string query = "SELECT naam, omschrijving, levenspunten, aanvalskans, minimumschade, maximumschade FROM Vijanden ORDER BY naam";
+    sqlite3_stmt *stmt;
+    if (!prepareAndBindStatement(query, &stmt, nullptr))
+    {
+        return false;
+    }
+
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        aNames.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+        aDescriptions.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1)));
+        aHealths.push_back(sqlite3_column_int(stmt, 2));
+        aAttackPercents.push_back(sqlite3_column_int(stmt, 3));
+        aMinDamages.push_back(sqlite3_column_int(stmt, 4));
+        aMaxDamages.push_back(sqlite3_column_int(stmt, 5));
+    }
+
+    sqlite3_finalize(stmt);
+    return !aNames.empty();
+}
+
+/**
+ * @brief Retrieves all objects from the database in one query.
+ *
+ * @param aNames The names of the objects.
+ * @param aDescriptions The descriptions of the objects.
+ * @param aTypes The types of the objects.
+ * @param aMinValues The minimum values of the objects.
+ * @param aMaxValues The maximum values of the objects.
+ * @param aProtections The protection of the objects.
+ * @return bool True if at least one object was retrieved, false otherwise.
+ */
+bool SQLReader::getAllObjects(Sean::Vector<Sean::String> &aNames, Sean::Vector<Sean::String> &aDescriptions, Sean::Vector<Sean::String> &aTypes, Sean::Vector<int> &aMinValues, Sean::Vector<int> &aMaxValues, Sean::Vector<int> &aProtections) const
+{
+    std::string query = "SELECT naam, omschrijving, type, minimumwaarde, maximumwaarde, bescherming FROM Objecten ORDER BY naam";
+    sqlite3_stmt *stmt;
+    if (!prepareAndBindStatement(query, &stmt, nullptr))
+    {
+        return false;
+    }
+
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        aNames.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+        aDescriptions.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1)));
+        aTypes.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 2)));
+        aMinValues.push_back(sqlite3_column_int(stmt, 3));
+        aMaxValues.push_back(sqlite3_column_int(stmt, 4));
+        aProtections.push_back(sqlite3_column_int(stmt, 5));
+    }
+
+    sqlite3_finalize(stmt);
+    return !aNames.empty();
+}
+
 // Private Methods
 
 /**
@@ -1,5 +1,4 @@
 #include "WeaponObject.h"
-#include "RandomGenerator.h"
 #include <iostream>
 #include <utility> // for std::swap
 
@@ -16,7 +15,17 @@
  * @param aID The ID of the weapon object.
  */
 WeaponObject::WeaponObject(const Sean::String aName, const Sean::String aDescription, int aMinDamage, int aMaxDamage, ObjectType aType, int aID)
-    : GameObject(aName, aDescription, aType, aID), mMinDamage(aMinDamage), mMaxDamage(aMaxDamage)
+    : GameObject(aName, aDescription, aType, aMinDamage, aMaxDamage, aID)
+{
+}
+
+/**
+ * @brief Constructs a weapon that wraps an object value.
+ * 
+ * @param aValue The value of the object.
+ */
+WeaponObject::WeaponObject(const ObjectValue &aValue)
+    : GameObject(aValue)
 {
 }
 
@@ -26,7 +35,7 @@ WeaponObject::WeaponObject(const Sean::String aName, const Sean::String aDescrip
  * @param other The WeaponObject to copy.
  */
 WeaponObject::WeaponObject(const WeaponObject &other)
-    : GameObject(other), mMinDamage(other.mMinDamage), mMaxDamage(other.mMaxDamage)
+    : GameObject(other)
 {
 }
 
@@ -36,10 +45,8 @@ WeaponObject::WeaponObject(const WeaponObject &other)
  * @param other The WeaponObject to move.
  */
 WeaponObject::WeaponObject(WeaponObject &&other) noexcept
-    : GameObject(std::move(other)), mMinDamage(other.mMinDamage), mMaxDamage(other.mMaxDamage)
+    : GameObject(std::move(other))
 {
-    other.mMinDamage = 0;
-    other.mMaxDamage = 0;
 }
 
 // Assignment Operators
@@ -55,8 +62,6 @@ WeaponObject &WeaponObject::operator=(const WeaponObject &other)
     if (this != &other)
     {
         GameObject::operator=(other);
-        mMinDamage = other.mMinDamage;
-        mMaxDamage = other.mMaxDamage;
     }
     return *this;
 }
@@ -72,11 +77,6 @@ WeaponObject &WeaponObject::operator=(WeaponObject &&other) noexcept
     if (this != &other)
     {
         GameObject::operator=(std::move(other));
-        mMinDamage = other.mMinDamage;
-        mMaxDamage = other.mMaxDamage;
-
-        other.mMinDamage = 0;
-        other.mMaxDamage = 0;
     }
     return *this;
 }
@@ -98,8 +98,7 @@ IGameObject *WeaponObject::clone() const
  */
 void WeaponObject::printDescription() const
 {
-    std::cout << mDescription << std::endl;
-    std::cout << "Schade tussen: " << mMinDamage << " - " << mMaxDamage << std::endl;
+    mValue.printDescription();
 }
 
 /**
@@ -109,8 +108,7 @@ void WeaponObject::printDescription() const
  */
 int WeaponObject::getDamage() const
 {
-    RandomGenerator randomEngine;
-    return randomEngine.getRandomValue(mMinDamage, mMaxDamage);
+    return mValue.getValue();
 }
 
 /**
@@ -130,7 +128,7 @@ int WeaponObject::getValue() const
  */
 int WeaponObject::getMin() const
 {
-    return mMinDamage;
+    return mValue.getMin();
 }
 
 /**
@@ -140,18 +138,5 @@ int WeaponObject::getMin() const
  */
 int WeaponObject::getMax() const
 {
-    return mMaxDamage;
-}
-
-// Private Methods
-
-/**
- * @brief Swaps the contents of this WeaponObject with another.
- * 
- * @param other The WeaponObject to swap with.
- */
-void WeaponObject::swap(WeaponObject &other) noexcept
-{
-    std::swap(mMinDamage, other.mMinDamage);
-    std::swap(mMaxDamage, other.mMaxDamage);
+    return mValue.getMax();
 }
\ No newline at end of file
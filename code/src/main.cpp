@@ -1,13 +1,42 @@
+#include <chrono>
 #include <iostream>
+#include <string>
 
 #include "Game.h"
 
-int main()
+/**
+ * @brief Plays the game, optionally recording the session or replaying a recorded one.
+ *
+ * Usage: dungeon_crawler [--record <session> | --replay <session>]
+ */
+int main(int argc, char **argv)
 {
+    std::string option = argc == 3 ? argv[1] : "";
+    if (argc != 1 && option != "--record" && option != "--replay")
+    {
+        std::cerr << "Usage: " << argv[0] << " [--record <session> | --replay <session>]" << std::endl;
+        return 1;
+    }
+
     try
     {
         Game game;
+        if (option == "--record")
+        {
+            game.recordSession(argv[2]);
+        }
+        else if (option == "--replay")
+        {
+            game.replaySession(argv[2]);
+        }
+
+        auto start = std::chrono::steady_clock::now();
         game.run();
+        if (option == "--replay")
+        {
+            std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+            std::cerr << "Replayed " << argv[2] << " in " << duration.count() << " ms" << std::endl;
+        }
     }
     catch (const std::runtime_error &e)
     {
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "BinaryReader.h"
+#include "BinaryWriter.h"
+#include "DungeonLayout.h"
+#include "XmlReader.h"
+#include "Sean.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#define XMLPATH "/home/sean/school_stuff/leerjaar_4/minor/cpp/assessment-cplus-24-25-heavydragon99/xml/kasteelruine.xml"
+
+class BinaryTest : public ::testing::Test {
+protected:
+    std::string binaryPath;
+
+    void SetUp() override {
+        binaryPath = (std::filesystem::temp_directory_path() / "test_kasteelruine.bin").string();
+    }
+
+    void TearDown() override {
+        std::remove(binaryPath.c_str());
+    }
+};
+
+TEST_F(BinaryTest, LayoutFromXml) {
+    XmlReader xmlReader(XMLPATH);
+    DungeonLayout layout(xmlReader.getLocations());
+    ASSERT_EQ(layout.getRoomCount(), 14);
+    EXPECT_STREQ(layout.getAtom(layout.getRoom(0).mName), "Kasteelpoort");
+    EXPECT_EQ(layout.getExit(0, Sean::Direction::North), 1);
+    EXPECT_EQ(layout.getExit(0, Sean::Direction::South), DungeonLayout::NoRoom);
+    EXPECT_EQ(layout.getRoom(1).mEnemyCount, 2);
+    EXPECT_EQ(layout.getEnemies(1)[0], layout.getEnemies(1)[1]);
+    EXPECT_STREQ(layout.getAtom(layout.getEnemies(1)[0]), "Grote Rat");
+}
+
+TEST_F(BinaryTest, RoundTrip) {
+    XmlReader xmlReader(XMLPATH);
+    DungeonLayout layout(xmlReader.getLocations());
+    BinaryWriter(binaryPath.c_str()).write(layout);
+
+    ASSERT_TRUE(BinaryReader::isBinaryFile(binaryPath.c_str()));
+    BinaryReader binaryReader(binaryPath.c_str());
+    const DungeonLayout &loaded = binaryReader.getLayout();
+    ASSERT_EQ(loaded.getRoomCount(), layout.getRoomCount());
+    ASSERT_EQ(loaded.getAtomCount(), layout.getAtomCount());
+    for (uint32_t room = 0; room < layout.getRoomCount(); ++room) {
+        EXPECT_EQ(loaded.getRoom(room).mId, layout.getRoom(room).mId);
+        EXPECT_STREQ(loaded.getAtom(loaded.getRoom(room).mName), layout.getAtom(layout.getRoom(room).mName));
+        EXPECT_STREQ(loaded.getAtom(loaded.getRoom(room).mDescription), layout.getAtom(layout.getRoom(room).mDescription));
+        for (int direction = 0; direction < 4; ++direction) {
+            EXPECT_EQ(loaded.getExit(room, static_cast<Sean::Direction>(direction)), layout.getExit(room, static_cast<Sean::Direction>(direction)));
+        }
+        EXPECT_EQ(loaded.getRoom(room).mHiddenCount, layout.getRoom(room).mHiddenCount);
+        EXPECT_EQ(loaded.findRooms(loaded.getAtom(loaded.getRoom(room).mName)), layout.findRooms(layout.getAtom(layout.getRoom(room).mName)));
+    }
+    EXPECT_STREQ(loaded.getAtom(loaded.getHiddenObjects(4)[0]), "zak met goudstukken");
+}
+
+TEST_F(BinaryTest, XmlIsNotBinary) {
+    EXPECT_FALSE(BinaryReader::isBinaryFile(XMLPATH));
+    EXPECT_THROW(BinaryReader(XMLPATH), std::runtime_error);
+}
+
+TEST_F(BinaryTest, TruncatedFileThrows) {
+    XmlReader xmlReader(XMLPATH);
+    BinaryWriter(binaryPath.c_str()).write(DungeonLayout(xmlReader.getLocations()));
+    std::filesystem::resize_file(binaryPath, std::filesystem::file_size(binaryPath) - 4);
+    EXPECT_THROW(BinaryReader(binaryPath.c_str()), std::runtime_error);
+}
\ No newline at end of file
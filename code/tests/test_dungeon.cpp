@@ -5,8 +5,14 @@
 #include "Enemy.h"
 #include "GameObject.h"
 #include "ConsumableObject.h"
+#include "EventLog.h"
+#include "EventReader.h"
 #include "Sean.h"
 
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
 class MockLocationFactory
 {
 public:
@@ -103,19 +109,19 @@ TEST_F(DungeonTest, CreateGameObject)
 
 TEST_F(DungeonTest, PickUpObject)
 {
-    std::string objectName = dungeon->getCurrentLocation().getVisibleObjects()[0]->getName().c_str();
-    GameObject *obj = dungeon->pickUpObject(objectName.c_str());
-    ASSERT_NE(obj, nullptr);
-    delete obj;
+    std::string objectName = dungeon->getCurrentLocation().getVisibleObjects()[0].getName().c_str();
+    ObjectValue obj;
+    ASSERT_TRUE(dungeon->pickUpObject(objectName.c_str(), obj));
+    EXPECT_EQ(obj.getName(), objectName.c_str());
 }
 
 TEST_F(DungeonTest, PlaceObject)
 {
-    GameObject *obj = new ConsumableObject("harnas", "Description1", 1, 3, ObjectType::Gold, 1);
-    dungeon->placeObject(obj);
+    ConsumableObject obj("harnas", "Description1", 1, 3, ObjectType::Gold, 1);
+    dungeon->placeObject(obj.getObjectValue());
     auto &visibleObjects = dungeon->getCurrentLocation().getVisibleObjects();
     ASSERT_EQ(visibleObjects.size(), 2);
-    EXPECT_EQ(visibleObjects[1]->getName(), "harnas1");
+    EXPECT_EQ(visibleObjects[1].getName(), "harnas1");
 }
 
 TEST_F(DungeonTest, PrintShortDescription)
@@ -135,11 +141,11 @@ TEST_F(DungeonTest, PrintLongDescription)
     std::vector<std::string> vijanden;
     for(int i = 0; i < dungeon->getCurrentLocation().getVisibleObjects().size(); i++)
     {
-        objecten.push_back(dungeon->getCurrentLocation().getVisibleObjects()[i]->getName().c_str());
+        objecten.push_back(dungeon->getCurrentLocation().getVisibleObjects()[i].getName().c_str());
     }
-    for(int i = 0; i < dungeon->getCurrentLocation().getEnemies().size(); i++)
+    for(EntityStore::EntityId enemy : dungeon->getEntities().getEntitiesIn(dungeon->getCurrentRoom()))
     {
-        vijanden.push_back(dungeon->getCurrentLocation().getEnemies()[i].getName().c_str());
+        vijanden.push_back(dungeon->getEntities().getName(enemy).c_str());
     }
     std::string outputString = "Je staat in de locatie: De IJzeren Burcht\nEen fort van verroest metaal en ijzeren kettingen, gevuld met mechanische vallen en oude oorlogsmachines.\nObjecten:\n";
     if (objecten.empty()) {
@@ -174,16 +180,16 @@ TEST_F(DungeonTest, MoveLocation)
 TEST_F(DungeonTest, MoveHiddenObjects)
 {
     dungeon->moveHiddenObjects();
-    std::string objectName = dungeon->getCurrentLocation().getVisibleObjects()[1]->getName().c_str();
+    std::string objectName = dungeon->getCurrentLocation().getVisibleObjects()[1].getName().c_str();
     auto &visibleObjects = dungeon->getCurrentLocation().getVisibleObjects();
     ASSERT_EQ(visibleObjects.size(), 2);
-    EXPECT_EQ(visibleObjects[1]->getName(), objectName.c_str());
+    EXPECT_EQ(visibleObjects[1].getName(), objectName.c_str());
 }
 
 TEST_F(DungeonTest, PrintObject)
 {
     testing::internal::CaptureStdout();
-    std::string objectName = dungeon->getCurrentLocation().getVisibleObjects()[0]->getName().c_str();
+    std::string objectName = dungeon->getCurrentLocation().getVisibleObjects()[0].getName().c_str();
     bool found = dungeon->printObject(objectName.c_str());
     std::string output = testing::internal::GetCapturedStdout();
     EXPECT_TRUE(found);
@@ -196,9 +202,87 @@ TEST_F(DungeonTest, Teleport)
     EXPECT_NE(dungeon->getCurrentLocation().getName(), "De IJzeren Burcht1");
 }
 
+TEST_F(DungeonTest, TeleportDistance)
+{
+    Dungeon generated(400);
+    for (int i = 0; i < 20; ++i)
+    {
+        uint32_t from = generated.getCurrentRoom();
+        generated.teleport(5);
+        EXPECT_EQ(generated.getDistance(from, generated.getCurrentRoom()), 5);
+    }
+}
+
 TEST_F(DungeonTest, AttackEnemy)
 {
-    std::string enemyName = dungeon->getCurrentLocation().getEnemies()[0].getName().c_str();
+    std::string enemyName = dungeon->getEntities().getName(dungeon->getEntities().getEntitiesIn(dungeon->getCurrentRoom())[0]).c_str();
     bool result = dungeon->attackEnemy(enemyName.c_str(), 10);
     EXPECT_TRUE(result);
+}
+
+TEST_F(DungeonTest, MaterializeRadius)
+{
+    EXPECT_EQ(dungeon->getMaterializedCount(), 2);
+    dungeon->setMaterializeRadius(0);
+    EXPECT_EQ(dungeon->getMaterializedCount(), 1);
+    EXPECT_TRUE(dungeon->moveLocation(Sean::Direction::North));
+    EXPECT_EQ(dungeon->getCurrentLocation().getName(), "De Verzopen Crypte2");
+    // The start room was visited, so it stays materialized
+    EXPECT_EQ(dungeon->getMaterializedCount(), 2);
+}
+
+TEST_F(DungeonTest, FindRoute)
+{
+    std::vector<Sean::Direction> route;
+    ASSERT_TRUE(dungeon->findRoute("De Verzopen Crypte", route));
+    EXPECT_EQ(route, std::vector<Sean::Direction>{Sean::Direction::North});
+    EXPECT_EQ(dungeon->getDistance(0, 1), 1);
+    EXPECT_EQ(dungeon->getNextStep(0, 1), 1);
+    // There is no exit back to the start room
+    EXPECT_FALSE(dungeon->findRoute("Onbekende Locatie", route));
+    EXPECT_EQ(dungeon->getDistance(1, 0), Pathfinder::Unreachable);
+    dungeon->setExit(1, Sean::Direction::South, 0);
+    EXPECT_EQ(dungeon->getDistance(1, 0), 1);
+}
+
+TEST_F(DungeonTest, Fork)
+{
+    std::unique_ptr<Dungeon> branch = dungeon->fork();
+    // Unchanged rooms are shared with the branch
+    EXPECT_EQ(&branch->getCurrentLocation(), &dungeon->getCurrentLocation());
+
+    std::string objectName = dungeon->getCurrentLocation().getVisibleObjects()[0].getName().c_str();
+    ObjectValue obj;
+    ASSERT_TRUE(branch->pickUpObject(objectName.c_str(), obj));
+    EXPECT_NE(&branch->getCurrentLocation(), &dungeon->getCurrentLocation());
+    EXPECT_EQ(branch->getCurrentLocation().getVisibleObjects().size(), 0);
+    EXPECT_EQ(dungeon->getCurrentLocation().getVisibleObjects().size(), 1);
+
+    EXPECT_TRUE(branch->moveLocation(Sean::Direction::North));
+    branch->setExit(1, Sean::Direction::South, 0);
+    EXPECT_EQ(branch->getDistance(1, 0), 1);
+    EXPECT_EQ(dungeon->getDistance(1, 0), Pathfinder::Unreachable);
+    EXPECT_EQ(dungeon->getCurrentRoom(), 0);
+}
+
+TEST_F(DungeonTest, ForkRecordsNoEvents)
+{
+    std::string logPath = (std::filesystem::temp_directory_path() / "test_dungeon_events.evt").string();
+    EventLog &log = EventLog::getInstance();
+    log.open(logPath);
+    dungeon->setEventLog(&log);
+
+    // Only the dungeon that is played records its moves, the branch looks ahead silently
+    std::unique_ptr<Dungeon> branch = dungeon->fork();
+    EXPECT_TRUE(branch->moveLocation(Sean::Direction::North));
+    EXPECT_TRUE(dungeon->moveLocation(Sean::Direction::North));
+    log.close();
+    dungeon->setEventLog(nullptr);
+
+    EventReader reader(logPath.c_str());
+    EventReader::Event event;
+    ASSERT_TRUE(reader.next(event));
+    EXPECT_EQ(event.mType, BinaryFormat::EventType::Move);
+    EXPECT_FALSE(reader.next(event));
+    std::remove(logPath.c_str());
 }
\ No newline at end of file
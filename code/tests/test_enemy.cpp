@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "Enemy.h"
+#include "EnemyFactory.h"
+#include "EntityStore.h"
 #include "Sean.h"
 
 // Test fixture class for Enemy
@@ -60,4 +62,37 @@ TEST_F(EnemyTest, GetAttack) {
 TEST_F(EnemyTest, GetHiddenObjects) {
     auto &hiddenObjects = enemy->getHiddenObjects();
     EXPECT_GE(hiddenObjects.size(), 0);
+}
+
+TEST(EnemyFactoryTest, CreateEnemies) {
+    EnemyFactory::resetCounter();
+    Sean::Vector<Sean::String> names;
+    names.push_back("Bandiet");
+    names.push_back("onbekend");
+    names.push_back("Bandiet");
+    Sean::Vector<Sean::Object<Enemy>> enemies = EnemyFactory::createEnemies(names);
+    ASSERT_EQ(enemies.size(), 2u);
+    EXPECT_EQ(enemies[0]->getName(), "Bandiet1");
+    EXPECT_EQ(enemies[1]->getName(), "Bandiet2");
+
+    Sean::Vector<Sean::Object<Enemy>> random = EnemyFactory::createEnemies(5);
+    ASSERT_EQ(random.size(), 5u);
+    EXPECT_FALSE(random[4]->isDead());
+}
+TEST(EnemyFactoryTest, SpawnEnemies) {
+    EnemyFactory::resetCounter();
+    EntityStore entities;
+    const char *names[] = {"Bandiet", "Oude Draak"};
+    ASSERT_TRUE(EnemyFactory::spawnEnemies(names, 2, entities, 4));
+    ASSERT_EQ(entities.getEntityCount(), 2u);
+    EXPECT_EQ(entities.getName(0), "Bandiet1");
+    EXPECT_EQ(entities.getName(1), "Oude Draak2");
+    EXPECT_EQ(entities.getPosition(1), 4u);
+    EXPECT_EQ(entities.getHealth(0), 6);
+    EXPECT_EQ(entities.takeLoot(1).size(), 3u);
+
+    // A name that is not found spawns nothing at all
+    const char *unknown[] = {"Bandiet", "onbekend"};
+    EXPECT_FALSE(EnemyFactory::spawnEnemies(unknown, 2, entities, 4));
+    EXPECT_EQ(entities.getEntityCount(), 2u);
 }
\ No newline at end of file
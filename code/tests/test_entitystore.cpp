@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "EntityStore.h"
+#include "Enemy.h"
+#include "EnemyFactory.h"
+#include "LootTables.h"
+#include "Sean.h"
+
+class EntityStoreTest : public ::testing::Test {
+protected:
+    EntityStore store;
+};
+
+TEST_F(EntityStoreTest, AddEnemy) {
+    Enemy enemy("Goblin", "Description1", 100, 50, 10, 20, 1);
+    EntityStore::EntityId entity = store.addEnemy(enemy, 3);
+    ASSERT_EQ(store.getEntityCount(), 1);
+    EXPECT_EQ(store.getName(entity), "Goblin1");
+    EXPECT_EQ(store.getHealth(entity), 100);
+    EXPECT_EQ(store.getAttackStats(entity).mMaximumDamage, 20);
+    EXPECT_EQ(store.getPosition(entity), 3);
+    ASSERT_EQ(store.getEntitiesIn(3).size(), 1);
+    EXPECT_EQ(store.getEntitiesIn(3)[0], entity);
+}
+
+TEST_F(EntityStoreTest, SetPosition) {
+    Enemy first("Goblin", "Description2", 100, 50, 10, 20, 2);
+    Enemy second("Goblin", "Description3", 100, 50, 10, 20, 3);
+    EntityStore::EntityId firstEntity = store.addEnemy(first, 0);
+    EntityStore::EntityId secondEntity = store.addEnemy(second, 0);
+    store.setPosition(firstEntity, 1);
+    EXPECT_EQ(store.getPosition(firstEntity), 1);
+    ASSERT_EQ(store.getEntitiesIn(0).size(), 1);
+    EXPECT_EQ(store.getEntitiesIn(0)[0], secondEntity);
+    ASSERT_EQ(store.getEntitiesIn(1).size(), 1);
+    EXPECT_EQ(store.getEntitiesIn(1)[0], firstEntity);
+}
+
+TEST_F(EntityStoreTest, FindByName) {
+    Enemy enemy("Grote Rat", "Description4", 100, 50, 10, 20, 4);
+    EntityStore::EntityId entity = store.addEnemy(enemy, 0);
+    EXPECT_EQ(store.findByName(0, "Grote Rat4"), entity);
+    EXPECT_EQ(store.findByName(1, "Grote Rat4"), EntityStore::NoEntity);
+    store.takeDamage(entity, 150);
+    EXPECT_TRUE(store.isDead(entity));
+    EXPECT_EQ(store.findByName(0, "dode Grote Rat4"), entity);
+}
+
+TEST_F(EntityStoreTest, CopyKeepsLoot) {
+    Enemy enemy("Oude Draak", "Description5", 100, 50, 10, 20, 5);
+    EntityStore::EntityId entity = store.addEnemy(enemy, 0);
+    EntityStore copy(store);
+    // Both stores roll their own objects from the same table and seed
+    std::vector<ObjectValue> copyLoot = copy.takeLoot(entity);
+    std::vector<ObjectValue> loot = store.takeLoot(entity);
+    ASSERT_EQ(copyLoot.size(), 3);
+    ASSERT_EQ(loot.size(), 3);
+    EXPECT_EQ(loot[0].getTemplateId(), copyLoot[0].getTemplateId());
+    EXPECT_EQ(store.takeLoot(entity).size(), 0);
+    EXPECT_EQ(copy.takeLoot(entity).size(), 0);
+}
+
+TEST_F(EntityStoreTest, LootIsRolledWhenTaken) {
+    Enemy enemy("Oude Draak", "Description7", 100, 50, 10, 20, 7);
+    Enemy twin(enemy);
+    EntityStore::EntityId entity = store.addEnemy(enemy, 0);
+    EntityStore::EntityId twinEntity = store.addEnemy(twin, 0);
+    uint32_t table = LootTables::getInstance().find("Oude Draak");
+    ASSERT_NE(table, LootTables::NoLoot);
+    EXPECT_EQ(LootTables::getInstance().get(table).mMinimum, 3);
+
+    // The same table and seed roll the same objects, with new IDs
+    std::vector<ObjectValue> loot = store.takeLoot(entity);
+    std::vector<ObjectValue> twinLoot = store.takeLoot(twinEntity);
+    ASSERT_EQ(loot.size(), 3);
+    ASSERT_EQ(twinLoot.size(), 3);
+    for (size_t i = 0; i < loot.size(); ++i) {
+        EXPECT_EQ(loot[i].getTemplateId(), twinLoot[i].getTemplateId());
+        EXPECT_NE(loot[i].getName(), twinLoot[i].getName());
+    }
+    EXPECT_EQ(store.takeLoot(entity).size(), 0);
+}
+
+TEST_F(EntityStoreTest, EnemyWithoutLootTable) {
+    Enemy enemy("Skeletstrijder", "Description8", 100, 50, 10, 20, 8);
+    EntityStore::EntityId entity = store.addEnemy(enemy, 0);
+    EXPECT_EQ(store.takeLoot(entity).size(), 0);
+    EXPECT_EQ(LootTables::getInstance().find("Skeletstrijder"), LootTables::NoLoot);
+    EXPECT_EQ(LootTables::getInstance().find("Enemy"), LootTables::NoLoot);
+    EXPECT_EQ(LootTables::getInstance().roll(LootTables::NoLoot, 1).size(), 0);
+    EXPECT_THROW(LootTables::getInstance().get(0xFFFFFFFF), std::out_of_range);
+}
+
+TEST_F(EntityStoreTest, KindGivesNameAndDescription) {
+    Enemy enemy("Bandiet", "Description9", 100, 50, 10, 20, 9);
+    EntityStore::EntityId entity = store.addEnemy(enemy, 0);
+    uint32_t kind = EnemyFactory::findKind("Bandiet");
+    ASSERT_NE(kind, EnemyFactory::NoKind);
+    EXPECT_EQ(EnemyFactory::getKindName(kind), "Bandiet");
+    testing::internal::CaptureStdout();
+    store.printDescription(entity);
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), std::string(EnemyFactory::getKindDescription(kind).c_str()) + "\n");
+
+    // Only enemies of the database have a kind
+    Enemy unknown("Enemy", "Description10", 100, 50, 10, 20, 10);
+    EXPECT_EQ(EnemyFactory::findKind("Enemy"), EnemyFactory::NoKind);
+    EXPECT_THROW(store.addEnemy(unknown, 0), std::invalid_argument);
+    EXPECT_EQ(store.getEntityCount(), 1);
+}
\ No newline at end of file
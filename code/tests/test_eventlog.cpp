@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "EventLog.h"
+#include "EventReader.h"
+
+#include <climits>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class EventLogTest : public ::testing::Test {
+protected:
+    std::string logPath;
+
+    void SetUp() override {
+        logPath = (std::filesystem::temp_directory_path() / "test_events.evt").string();
+    }
+
+    void TearDown() override {
+        EventLog::getInstance().close();
+        std::remove(logPath.c_str());
+    }
+};
+
+TEST_F(EventLogTest, ReadsBackEvents) {
+    EventLog &log = EventLog::getInstance();
+    log.open(logPath);
+    log.logCommand("sla goblin");
+    log.logMove(3, 300000);
+    log.logAttack("goblin1", 7);
+    log.logDamage("goblin1", 0);
+    log.logPickup("dolk");
+    log.logDeath("goblin");
+    log.logScore("Speler", -5);
+    log.close();
+
+    EventReader reader(logPath.c_str());
+    EventReader::Event event;
+    const std::vector<std::vector<std::string>> expected = {
+        {"sla goblin"}, {"3", "300000"}, {"goblin1", "7"}, {"goblin1", "0"}, {"dolk"}, {"goblin"}, {"Speler", "-5"}};
+    uint64_t time = reader.getStartTime();
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_TRUE(reader.next(event));
+        EXPECT_EQ(event.mType, static_cast<BinaryFormat::EventType>(i));
+        EXPECT_EQ(event.mFields, expected[i]);
+        EXPECT_GE(event.mTime, time);
+        time = event.mTime;
+    }
+    EXPECT_FALSE(reader.next(event));
+    EXPECT_STREQ(EventReader::getTypeName(BinaryFormat::EventType::Attack), "attack");
+}
+
+TEST_F(EventLogTest, EncodesExtremeValues) {
+    EventLog &log = EventLog::getInstance();
+    log.open(logPath);
+    log.logMove(0, UINT32_MAX);
+    log.logScore("", INT_MIN);
+    log.logScore("", INT_MAX);
+    log.close();
+
+    EventReader reader(logPath.c_str());
+    EventReader::Event event;
+    ASSERT_TRUE(reader.next(event));
+    EXPECT_EQ(event.mFields[1], std::to_string(UINT32_MAX));
+    ASSERT_TRUE(reader.next(event));
+    EXPECT_EQ(event.mFields[1], std::to_string(INT_MIN));
+    ASSERT_TRUE(reader.next(event));
+    EXPECT_EQ(event.mFields[1], std::to_string(INT_MAX));
+}
+
+TEST_F(EventLogTest, EventsAreCompact) {
+    EventLog &log = EventLog::getInstance();
+    log.open(logPath);
+    for (int i = 0; i < 1000; ++i) {
+        log.logMove(i % 100, i % 100 + 1);
+    }
+    log.close();
+
+    // Type, time delta and two small room indexes take a few bytes per event
+    EXPECT_LT(std::filesystem::file_size(logPath), sizeof(BinaryFormat::EventHeader) + 1000 * 6);
+}
+
+TEST_F(EventLogTest, IgnoresEventsWhileClosed) {
+    EventLog &log = EventLog::getInstance();
+    EXPECT_FALSE(log.isOpen());
+    log.logCommand("kijk");
+    log.flush();
+    EXPECT_FALSE(std::filesystem::exists(logPath));
+}
+
+TEST_F(EventLogTest, RejectsDamagedLogs) {
+    EventLog &log = EventLog::getInstance();
+    log.open(logPath);
+    log.logPickup("klein levenselixer");
+    log.close();
+    std::filesystem::resize_file(logPath, std::filesystem::file_size(logPath) - 3);
+
+    EventReader reader(logPath.c_str());
+    EventReader::Event event;
+    EXPECT_THROW(reader.next(event), std::runtime_error);
+
+    {
+        std::ofstream file(logPath, std::ios_base::binary | std::ios_base::trunc);
+        file << "geen gebeurtenissen hier";
+    }
+    EXPECT_THROW(EventReader(logPath.c_str()), std::runtime_error);
+}
\ No newline at end of file
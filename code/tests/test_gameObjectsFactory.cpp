@@ -70,4 +70,27 @@ TEST_F(GameObjectFactoryTest, CreateRandomGameObject) {
 TEST_F(GameObjectFactoryTest, CreateGameObjectNotFound) {
     GameObject *obj = factory->createGameObject("Unknown Object");
     EXPECT_EQ(obj, nullptr);
+}
+
+TEST_F(GameObjectFactoryTest, CreateGameObjectsByName) {
+    Sean::Vector<Sean::String> names;
+    names.push_back("dolk");
+    names.push_back("Unknown Object");
+    names.push_back("harnas");
+    names.push_back("dolk");
+    Sean::Vector<Sean::Object<GameObject>> objects = factory->createGameObjects(names);
+    ASSERT_EQ(objects.size(), 3u);
+    EXPECT_EQ(objects[0]->getName(), "dolk1");
+    EXPECT_EQ(objects[1]->getName(), "harnas2");
+    EXPECT_EQ(objects[1]->getType(), ObjectType::Armor);
+    EXPECT_EQ(objects[2]->getName(), "dolk3");
+}
+
+TEST_F(GameObjectFactoryTest, CreateRandomGameObjects) {
+    Sean::Vector<Sean::Object<GameObject>> objects = factory->createGameObjects(10);
+    ASSERT_EQ(objects.size(), 10u);
+    for (size_t i = 0; i < objects.size(); ++i) {
+        EXPECT_FALSE(objects[i]->getName().empty());
+    }
+    EXPECT_TRUE(factory->createGameObjects(0).empty());
 }
\ No newline at end of file
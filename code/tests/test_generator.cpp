@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "DungeonGenerator.h"
+#include "DungeonLayout.h"
+#include "Sean.h"
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static Sean::Direction opposite(uint32_t aDirection) {
+    return static_cast<Sean::Direction>((aDirection + 2) % DungeonLayout::ExitsPerRoom);
+}
+
+TEST(DungeonGeneratorTest, ConnectedWithReverseExits) {
+    DungeonGenerator::Settings settings(1000);
+    settings.mSeed = 1;
+    DungeonLayout layout = DungeonGenerator(settings).generate();
+    ASSERT_EQ(layout.getRoomCount(), 1000);
+    std::vector<bool> reached(layout.getRoomCount(), false);
+    std::vector<uint32_t> queue{0};
+    reached[0] = true;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        for (uint32_t direction = 0; direction < DungeonLayout::ExitsPerRoom; ++direction) {
+            uint32_t target = layout.getExit(queue[head], static_cast<Sean::Direction>(direction));
+            if (target != DungeonLayout::NoRoom && !reached[target]) {
+                reached[target] = true;
+                queue.push_back(target);
+            }
+        }
+    }
+    EXPECT_EQ(queue.size(), layout.getRoomCount());
+    for (uint32_t room = 0; room < layout.getRoomCount(); ++room) {
+        for (uint32_t direction = 0; direction < DungeonLayout::ExitsPerRoom; ++direction) {
+            uint32_t target = layout.getExit(room, static_cast<Sean::Direction>(direction));
+            if (target != DungeonLayout::NoRoom) {
+                EXPECT_EQ(layout.getExit(target, opposite(direction)), room);
+            }
+        }
+    }
+}
+
+TEST(DungeonGeneratorTest, SameSeedSameDungeon) {
+    DungeonGenerator::Settings settings(500);
+    settings.mSeed = 7;
+    DungeonLayout first = DungeonGenerator(settings).generate();
+    settings.mThreadCount = 1;
+    DungeonLayout second = DungeonGenerator(settings).generate();
+    for (uint32_t room = 0; room < first.getRoomCount(); ++room) {
+        EXPECT_STREQ(first.getAtom(first.getRoom(room).mName), second.getAtom(second.getRoom(room).mName));
+        EXPECT_EQ(first.getRoom(room).mEnemyCount, second.getRoom(room).mEnemyCount);
+        EXPECT_EQ(first.getRoom(room).mVisibleCount, second.getRoom(room).mVisibleCount);
+        EXPECT_EQ(first.getExit(room, Sean::Direction::East), second.getExit(room, Sean::Direction::East));
+    }
+}
+
+TEST(DungeonGeneratorTest, Densities) {
+    DungeonGenerator::Settings settings(200);
+    settings.mEnemyPercent = 0;
+    settings.mVisibleObjectPercent = 100;
+    settings.mHiddenObjectPercent = 0;
+    DungeonLayout layout = DungeonGenerator(settings).generate();
+    for (uint32_t room = 0; room < layout.getRoomCount(); ++room) {
+        EXPECT_EQ(layout.getRoom(room).mEnemyCount, 0);
+        EXPECT_EQ(layout.getRoom(room).mVisibleCount, DungeonGenerator::MaxObjectsPerRoom);
+        EXPECT_EQ(layout.getRoom(room).mHiddenCount, 0);
+    }
+}
+
+TEST(DungeonGeneratorTest, UniqueNamesBeyondCatalog) {
+    DungeonGenerator::Settings settings(5000);
+    DungeonLayout layout = DungeonGenerator(settings).generate();
+    std::set<std::string> names;
+    for (uint32_t room = 0; room < layout.getRoomCount(); ++room) {
+        names.insert(layout.getAtom(layout.getRoom(room).mName));
+    }
+    EXPECT_EQ(names.size(), layout.getRoomCount());
+}
+
+TEST(DungeonGeneratorTest, NoRooms) {
+    EXPECT_THROW(DungeonGenerator(DungeonGenerator::Settings(0)), std::invalid_argument);
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "DungeonLayout.h"
+#include "Sean.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class DungeonLayoutTest : public ::testing::Test {
+protected:
+    Sean::Vector<Sean::ParsedLocations> parsedLocations;
+
+    void addLocation(int aId, int aNorth, int aSouth) {
+        Sean::ParsedLocations location;
+        location.mName = "Kamer";
+        location.mDescription = "Een lege kamer.";
+        location.mId = aId;
+        location.mDirections[0].mDirection = Sean::Direction::North;
+        location.mDirections[0].mID = aNorth;
+        location.mDirections[1].mDirection = Sean::Direction::South;
+        location.mDirections[1].mID = aSouth;
+        parsedLocations.push_back(location);
+    }
+};
+
+TEST_F(DungeonLayoutTest, SparseIds) {
+    addLocation(100, 0, 7);
+    addLocation(7, 100, 0);
+    DungeonLayout layout(parsedLocations);
+    ASSERT_EQ(layout.getRoomCount(), 2);
+    EXPECT_EQ(layout.getExit(0, Sean::Direction::South), 1);
+    EXPECT_EQ(layout.getExit(1, Sean::Direction::North), 0);
+}
+
+TEST_F(DungeonLayoutTest, ExitAfterEmptyDirection) {
+    addLocation(1, 0, 2);
+    addLocation(2, 0, 0);
+    DungeonLayout layout(parsedLocations);
+    EXPECT_EQ(layout.getExit(0, Sean::Direction::North), DungeonLayout::NoRoom);
+    EXPECT_EQ(layout.getExit(0, Sean::Direction::South), 1);
+}
+
+TEST_F(DungeonLayoutTest, ReportsAllErrors) {
+    addLocation(1, 5, 2);
+    addLocation(2, 6, 0);
+    addLocation(2, 0, 0);
+    try {
+        DungeonLayout layout(parsedLocations);
+        FAIL() << "Expected std::runtime_error";
+    }
+    catch (const std::runtime_error &e) {
+        std::string report = e.what();
+        EXPECT_NE(report.find("Duplicate location ID 2"), std::string::npos);
+        EXPECT_NE(report.find("Location 1 has an exit to unknown location ID 5"), std::string::npos);
+        EXPECT_NE(report.find("Location 2 has an exit to unknown location ID 6"), std::string::npos);
+    }
+}
+
+TEST_F(DungeonLayoutTest, UnreachableRooms) {
+    addLocation(1, 2, 0);
+    addLocation(2, 0, 1);
+    addLocation(3, 1, 0);
+    addLocation(4, 0, 9);
+    try {
+        DungeonLayout layout(parsedLocations);
+        FAIL() << "Expected std::runtime_error";
+    }
+    catch (const std::runtime_error &e) {
+        std::string report = e.what();
+        EXPECT_EQ(report.find("Location 1 cannot be reached"), std::string::npos);
+        EXPECT_EQ(report.find("Location 2 cannot be reached"), std::string::npos);
+        EXPECT_NE(report.find("Location 3 cannot be reached from the start location"), std::string::npos);
+        EXPECT_NE(report.find("Location 4 cannot be reached from the start location"), std::string::npos);
+        EXPECT_NE(report.find("Location 4 has an exit to unknown location ID 9"), std::string::npos);
+    }
+}
+
+TEST_F(DungeonLayoutTest, FindRoomsByName) {
+    addLocation(1, 0, 2);
+    addLocation(2, 1, 3);
+    addLocation(3, 2, 0);
+    parsedLocations[1].mName = "Gang";
+    DungeonLayout layout(parsedLocations);
+    EXPECT_EQ(layout.findRooms("Kamer"), (std::vector<uint32_t>{0, 2}));
+    EXPECT_EQ(layout.findRooms("Gang"), (std::vector<uint32_t>{1}));
+    EXPECT_TRUE(layout.findRooms("Een lege kamer.").empty());
+    EXPECT_TRUE(layout.findRooms("Zaal").empty());
+
+    Sean::ParsedLocations location = parsedLocations[1];
+    location.mId = 4;
+    layout.addRoom(location);
+    EXPECT_EQ(layout.findRooms("Gang"), (std::vector<uint32_t>{1, 3}));
+}
\ No newline at end of file
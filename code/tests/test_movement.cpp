@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "MovementScheduler.h"
+#include "EntityStore.h"
+#include "RoomGraph.h"
+#include "DungeonLayout.h"
+#include "Enemy.h"
+#include "Sean.h"
+
+class MovementSchedulerTest : public ::testing::Test {
+protected:
+    DungeonLayout layout;
+    EntityStore entities;
+    MovementScheduler scheduler;
+
+    void SetUp() override {
+        // Room 0 and 1 are connected both ways, room 2 has no exits
+        for (int i = 0; i < 3; ++i) {
+            Sean::ParsedLocations location;
+            location.mName = "Kamer";
+            location.mDescription = "Een lege kamer.";
+            location.mId = i + 1;
+            layout.addRoom(location);
+        }
+        layout.setExit(0, Sean::Direction::North, 1);
+        layout.setExit(1, Sean::Direction::South, 0);
+    }
+
+    EntityStore::EntityId addEnemy(uint32_t aRoom, int aHealth) {
+        Enemy enemy("Goblin", "Description", aHealth, 50, 1, 2, static_cast<int>(entities.getEntityCount()) + 1);
+        return entities.addEnemy(enemy, aRoom);
+    }
+};
+
+TEST_F(MovementSchedulerTest, MovesAlongExits) {
+    RoomGraph graph(layout);
+    for (int i = 0; i < 50; ++i) {
+        addEnemy(0, 10);
+    }
+    scheduler.planMoves(entities, graph, 1);
+    const std::vector<MovementScheduler::Move> &moves = scheduler.getPlannedMoves();
+    EXPECT_FALSE(moves.empty());
+    EXPECT_LT(moves.size(), 50);
+    for (const MovementScheduler::Move &move : moves) {
+        EXPECT_EQ(move.mRoom, 1);
+    }
+    size_t moved = moves.size();
+    scheduler.applyMoves(entities, 1);
+    EXPECT_EQ(entities.getEntitiesIn(1).size(), moved);
+    EXPECT_EQ(entities.getEntitiesIn(0).size(), 50 - moved);
+    EXPECT_TRUE(scheduler.getPlannedMoves().empty());
+}
+
+TEST_F(MovementSchedulerTest, DeadAndTrappedEnemiesStay) {
+    RoomGraph graph(layout);
+    for (int i = 0; i < 20; ++i) {
+        addEnemy(0, 0);
+        addEnemy(2, 10);
+    }
+    scheduler.planMoves(entities, graph, 1);
+    EXPECT_TRUE(scheduler.getPlannedMoves().empty());
+}
+
+TEST_F(MovementSchedulerTest, OnlyActiveRoomsArePlanned) {
+    RoomGraph graph(layout);
+    for (int i = 0; i < 50; ++i) {
+        addEnemy(1, 10);
+    }
+    scheduler.planMoves(entities, graph, {0}, 1);
+    EXPECT_TRUE(scheduler.getPlannedMoves().empty());
+    scheduler.planMoves(entities, graph, {1}, 1);
+    EXPECT_FALSE(scheduler.getPlannedMoves().empty());
+    scheduler.applyMoves(entities, 1);
+    EXPECT_EQ(entities.getLastSimulated(0), 1);
+}
+
+TEST_F(MovementSchedulerTest, CatchUpStaleEnemies) {
+    RoomGraph graph(layout);
+    for (int i = 0; i < 50; ++i) {
+        addEnemy(0, 10);
+    }
+    EntityStore::EntityId trapped = addEnemy(2, 10);
+    scheduler.catchUp(entities, graph, {0, 2}, 100);
+    EXPECT_FALSE(entities.getEntitiesIn(1).empty());
+    EXPECT_EQ(entities.getPosition(trapped), 2);
+    for (EntityStore::EntityId entity = 0; entity < entities.getEntityCount(); ++entity) {
+        EXPECT_EQ(entities.getLastSimulated(entity), 100);
+    }
+}
+
+TEST_F(MovementSchedulerTest, SameResultForAnyThreadCount) {
+    RoomGraph graph(layout);
+    for (size_t i = 0; i < 4 * MovementScheduler::MinEntitiesPerThread; ++i) {
+        addEnemy(i % 2, 10);
+    }
+    scheduler.setSeed(42);
+    scheduler.setThreadCount(1);
+    scheduler.planMoves(entities, graph, 7);
+    std::vector<MovementScheduler::Move> single = scheduler.getPlannedMoves();
+    scheduler.setThreadCount(4);
+    scheduler.planMoves(entities, graph, 7);
+    const std::vector<MovementScheduler::Move> &parallel = scheduler.getPlannedMoves();
+    ASSERT_EQ(parallel.size(), single.size());
+    for (size_t i = 0; i < single.size(); ++i) {
+        EXPECT_EQ(parallel[i].mEntity, single[i].mEntity);
+        EXPECT_EQ(parallel[i].mRoom, single[i].mRoom);
+    }
+}
\ No newline at end of file
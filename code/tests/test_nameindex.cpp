@@ -0,0 +1,25 @@
+#include <gtest/gtest.h>
+#include "NameIndex.h"
+#include "Sean.h"
+
+#include <utility>
+
+TEST(NameIndexTest, FindsRows) {
+    Sean::Vector<Sean::String> names;
+    names.push_back("dolk");
+    names.push_back("zwaard");
+    names.push_back("dolk");
+    NameIndex index(names);
+    EXPECT_EQ(index.find(Sean::String("zwaard")), 1u);
+    EXPECT_EQ(index.find("dolk"), 0u);
+    EXPECT_EQ(index.find("schild"), NameIndex::NoRow);
+    EXPECT_EQ(NameIndex().find("dolk"), NameIndex::NoRow);
+}
+
+TEST(NameIndexTest, MovedColumnKeepsKeys) {
+    Sean::Vector<Sean::String> names;
+    names.push_back("een naam die te lang is voor een kleine buffer");
+    NameIndex index(names);
+    Sean::Vector<Sean::String> moved(std::move(names));
+    EXPECT_EQ(index.find(moved[0]), 0u);
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+#include "NameSampler.h"
+#include "RandomStream.h"
+
+#include <set>
+#include <stdexcept>
+
+TEST(NameSamplerTest, EveryNameOncePerRound) {
+    NameSampler sampler(10, RandomStream(3, 0, 0));
+    std::set<size_t> indexes;
+    for (size_t i = 0; i < 10; ++i) {
+        NameSampler::Draw draw = sampler.draw(i);
+        EXPECT_EQ(draw.mVariant, 0);
+        indexes.insert(draw.mIndex);
+    }
+    EXPECT_EQ(indexes.size(), 10);
+    EXPECT_EQ(sampler.draw(12).mVariant, 1);
+    EXPECT_EQ(sampler.draw(12).mIndex, sampler.draw(2).mIndex);
+}
+
+TEST(NameSamplerTest, VariantNames) {
+    EXPECT_EQ(NameSampler::getVariantName("Binnenplaats", 0), "Binnenplaats");
+    EXPECT_EQ(NameSampler::getVariantName("Binnenplaats", 1), "Binnenplaats II");
+    EXPECT_EQ(NameSampler::getVariantName("Binnenplaats", 3), "Binnenplaats IV");
+    EXPECT_EQ(NameSampler::getVariantName("Binnenplaats", 1993), "Binnenplaats MCMXCIV");
+    EXPECT_EQ(NameSampler::getVariantName("Binnenplaats", 4999), "Binnenplaats 5000");
+}
+
+TEST(NameSamplerTest, EmptyCatalog) {
+    EXPECT_THROW(NameSampler(0, RandomStream(3, 0, 0)), std::invalid_argument);
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "ObjectPool.h"
+#include "GoldObject.h"
+#include "Location.h"
+
+#include <thread>
+#include <vector>
+
+struct PoolTestBlock {
+    double mValues[3];
+};
+
+TEST(ObjectPoolTest, ReusesFreedBlocks) {
+    void *first = ObjectPool<PoolTestBlock>::allocate(sizeof(PoolTestBlock));
+    ObjectPool<PoolTestBlock>::deallocate(first, sizeof(PoolTestBlock));
+    void *second = ObjectPool<PoolTestBlock>::allocate(sizeof(PoolTestBlock));
+    EXPECT_EQ(first, second);
+    ObjectPool<PoolTestBlock>::deallocate(second, sizeof(PoolTestBlock));
+    EXPECT_EQ(ObjectPool<PoolTestBlock>::getChunkCount(), 1u);
+}
+
+TEST(ObjectPoolTest, LargerRequestsUseGlobalAllocator) {
+    size_t chunks = ObjectPool<PoolTestBlock>::getChunkCount();
+    void *block = ObjectPool<PoolTestBlock>::allocate(sizeof(PoolTestBlock) * 4);
+    ASSERT_NE(block, nullptr);
+    ObjectPool<PoolTestBlock>::deallocate(block, sizeof(PoolTestBlock) * 4);
+    EXPECT_EQ(ObjectPool<PoolTestBlock>::getChunkCount(), chunks);
+}
+
+TEST(ObjectPoolTest, ThreadsShareChunks) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (int round = 0; round < 10; ++round) {
+                std::vector<void *> blocks;
+                for (size_t i = 0; i < ObjectPool<PoolTestBlock>::BlocksPerChunk; ++i) {
+                    blocks.push_back(ObjectPool<PoolTestBlock>::allocate(sizeof(PoolTestBlock)));
+                }
+                for (void *block : blocks) {
+                    ObjectPool<PoolTestBlock>::deallocate(block, sizeof(PoolTestBlock));
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    // Every thread needs at most one chunk and hands it back when it exits.
+    EXPECT_LE(ObjectPool<PoolTestBlock>::getChunkCount(), 5u);
+}
+
+TEST(ObjectPoolTest, GameObjectsAndLocationsUsePool) {
+    GameObject *object = new GoldObject("Buidel", "Een buidel met munten.", 5, 10, ObjectType::Gold, 1);
+    delete object;
+    GameObject *reused = new GoldObject("Buidel", "Een buidel met munten.", 5, 10, ObjectType::Gold, 2);
+    EXPECT_EQ(object, reused);
+    delete reused;
+    EXPECT_GE(ObjectPool<GameObject>::getChunkCount(), 1u);
+
+    Sean::Object<Location> location(new Location("Grot", "Een donkere grot.", 1));
+    EXPECT_GE(ObjectPool<Location>::getChunkCount(), 1u);
+}
\ No newline at end of file
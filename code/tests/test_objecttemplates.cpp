@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+#include "ObjectTemplates.h"
+#include "GoldObject.h"
+#include "WeaponObject.h"
+#include "Sean.h"
+
+TEST(ObjectTemplatesTest, InternSharesEqualTemplates) {
+    ObjectTemplates &templates = ObjectTemplates::getInstance();
+    uint32_t first = templates.intern("Beker", "Een zilveren beker.", ObjectType::Gold, 1, 5);
+    uint32_t second = templates.intern("Beker", "Een zilveren beker.", ObjectType::Gold, 1, 5);
+    uint32_t other = templates.intern("Beker", "Een gouden beker.", ObjectType::Gold, 1, 5);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_NE(first, ObjectTemplates::EmptyTemplate);
+    EXPECT_EQ(templates.get(other).mDescription, "Een gouden beker.");
+    EXPECT_EQ(templates.get(ObjectTemplates::EmptyTemplate).mMaximum, 0);
+    EXPECT_THROW(templates.get(static_cast<uint32_t>(templates.getCount())), std::out_of_range);
+}
+
+TEST(ObjectTemplatesTest, ObjectsShareTemplate) {
+    GoldObject first("Zak", "Een zak met munten.", 10, 20, ObjectType::Gold, 1);
+    GoldObject second("Zak", "Een zak met munten.", 10, 20, ObjectType::Gold, 2);
+    WeaponObject weapon("Zak", "Een zak met munten.", 10, 20, ObjectType::Weapon, 3);
+    EXPECT_EQ(first.getTemplateId(), second.getTemplateId());
+    EXPECT_NE(first.getTemplateId(), weapon.getTemplateId());
+    EXPECT_EQ(second.getName(), "Zak2");
+    EXPECT_EQ(second.getMax(), 20);
+    // The object classes add no state of their own
+    EXPECT_EQ(sizeof(GoldObject), sizeof(GameObject));
+    EXPECT_EQ(sizeof(WeaponObject), sizeof(GameObject));
+}
\ No newline at end of file
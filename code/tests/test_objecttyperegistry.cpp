@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "ObjectTypeRegistry.h"
+#include "ArmorObject.h"
+#include "SqlReader.h"
+#include "WeaponObject.h"
+#include "Sean.h"
+
+#include <memory>
+
+TEST(ObjectTypeRegistryTest, AllTableTypesAreRegistered) {
+    ObjectTypeRegistry &registry = ObjectTypeRegistry::getInstance();
+    Sean::Vector<Sean::String> rows;
+    ASSERT_TRUE(SQLReader::getInstance().getAllObjectTypes(rows));
+    for (size_t i = 0; i < rows.size(); ++i) {
+        uint32_t type = registry.find(rows[i]);
+        ASSERT_NE(type, ObjectTypeRegistry::InvalidType) << rows[i];
+        EXPECT_EQ(registry.get(type).mName, rows[i]);
+    }
+    EXPECT_EQ(registry.find("onbekend"), ObjectTypeRegistry::InvalidType);
+    EXPECT_THROW(registry.get(ObjectTypeRegistry::InvalidType), std::out_of_range);
+}
+
+TEST(ObjectTypeRegistryTest, CreateDispatchesOnIndex) {
+    ObjectTypeRegistry &registry = ObjectTypeRegistry::getInstance();
+    std::unique_ptr<GameObject> armor(registry.create(registry.find("wapenrusting"), "Schild", "Een houten schild.", 0, 0, 3, 7));
+    ASSERT_NE(dynamic_cast<ArmorObject *>(armor.get()), nullptr);
+    EXPECT_EQ(armor->getValue(), 3);
+    EXPECT_EQ(armor->getName(), "Schild7");
+
+    std::unique_ptr<GameObject> potion(registry.create(registry.find("ervaringsdrank"), "Drankje", "Een bruisend drankje.", 1, 2, 0, 8));
+    EXPECT_TRUE(potion->isConsumableExperience());
+}
+
+TEST(ObjectTypeRegistryTest, CreateFromInternedTemplate) {
+    ObjectTypeRegistry &registry = ObjectTypeRegistry::getInstance();
+    uint32_t type = registry.find("wapenrusting");
+    uint32_t objectTemplate = registry.internTemplate(type, "Schild", "Een houten schild.", 0, 0, 3);
+    EXPECT_EQ(registry.internTemplate(type, "Schild", "Een houten schild.", 0, 0, 3), objectTemplate);
+
+    std::unique_ptr<GameObject> first(registry.create(type, objectTemplate, 10));
+    std::unique_ptr<GameObject> second(registry.create(type, objectTemplate, 11));
+    ASSERT_NE(dynamic_cast<ArmorObject *>(second.get()), nullptr);
+    EXPECT_EQ(second->getValue(), 3);
+    EXPECT_EQ(first->getTemplateId(), second->getTemplateId());
+    EXPECT_EQ(second->getName(), "Schild11");
+}
+
+TEST(ObjectTypeRegistryTest, RegisterNewType) {
+    ObjectTypeRegistry &registry = ObjectTypeRegistry::getInstance();
+    size_t count = registry.getCount();
+    uint32_t type = registry.registerType("werpmes", ObjectType::Weapon, &ObjectTypeRegistry::construct<WeaponObject>);
+    EXPECT_EQ(registry.getCount(), count + 1);
+    EXPECT_EQ(registry.find("werpmes"), type);
+    EXPECT_EQ(registry.registerType("werpmes", ObjectType::Weapon, &ObjectTypeRegistry::construct<WeaponObject>), type);
+    EXPECT_THROW(registry.registerType("leeg", ObjectType::Gold, nullptr), std::invalid_argument);
+
+    std::unique_ptr<GameObject> knife(registry.create(type, "Werpmes", "Een klein mes.", 2, 4, 0, 9));
+    EXPECT_TRUE(knife->isWeapon());
+}
\ No newline at end of file
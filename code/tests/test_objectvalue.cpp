@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "ObjectValue.h"
+#include "ObjectTemplates.h"
+#include "ArmorObject.h"
+#include "GoldObject.h"
+#include "Sean.h"
+
+#include <vector>
+
+class ObjectValueTest : public ::testing::Test {
+protected:
+    uint32_t armorTemplate;
+    uint32_t goldTemplate;
+
+    void SetUp() override {
+        armorTemplate = ObjectTemplates::getInstance().intern("Maliënkolder", "Een hemd van ijzeren ringen.", ObjectType::Armor, 4, 4);
+        goldTemplate = ObjectTemplates::getInstance().intern("Buidel", "Een buidel met munten.", ObjectType::Gold, 5, 10);
+    }
+};
+
+TEST_F(ObjectValueTest, TypeTests) {
+    ObjectValue armor(armorTemplate, 1);
+    ObjectValue gold(goldTemplate, 2);
+    EXPECT_TRUE(armor.isArmor());
+    EXPECT_FALSE(armor.isWeapon());
+    EXPECT_TRUE(gold.isMoney());
+    EXPECT_EQ(gold.getType(), ObjectType::Gold);
+    EXPECT_EQ(armor.getName(), "Maliënkolder1");
+    EXPECT_EQ(armor.getValue(), 4);
+    int value = gold.getValue();
+    EXPECT_GE(value, 5);
+    EXPECT_LE(value, 10);
+    EXPECT_LE(sizeof(ObjectValue), 3 * sizeof(uint32_t));
+}
+
+TEST_F(ObjectValueTest, ToObject) {
+    ObjectValue armor(armorTemplate, 3);
+    Sean::Object<GameObject> object(armor.toObject());
+    ASSERT_NE(dynamic_cast<ArmorObject *>(object.get()), nullptr);
+    EXPECT_EQ(object->getName(), "Maliënkolder3");
+    EXPECT_EQ(object->getObjectValue().getTemplateId(), armorTemplate);
+    EXPECT_EQ(static_cast<ArmorObject *>(object.get())->getArmor(), 4);
+}
+
+TEST_F(ObjectValueTest, PrintDescriptionMatchesObject) {
+    GoldObject object("Buidel", "Een buidel met munten.", 5, 10, ObjectType::Gold, 4);
+    testing::internal::CaptureStdout();
+    object.printDescription();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, "Een buidel met munten.\nBevat tussen 5 - 10 goudstukken\n");
+    EXPECT_EQ(object.getObjectValue().getTemplateId(), goldTemplate);
+}
+
+TEST_F(ObjectValueTest, StoredContiguously) {
+    std::vector<ObjectValue> values;
+    for (int i = 0; i < 100; ++i) {
+        values.emplace_back(i % 2 == 0 ? armorTemplate : goldTemplate, i);
+    }
+    size_t armorCount = 0;
+    for (const ObjectValue &value : values) {
+        armorCount += value.isArmor() ? 1 : 0;
+    }
+    EXPECT_EQ(armorCount, 50);
+    EXPECT_EQ(values[99].getName(), "Buidel99");
+}
+TEST_F(ObjectValueTest, HasName) {
+    ObjectValue armor(armorTemplate, 120);
+    EXPECT_TRUE(armor.hasName("Maliënkolder120"));
+    EXPECT_FALSE(armor.hasName("Maliënkolder12"));
+    EXPECT_FALSE(armor.hasName("Maliënkolder1200"));
+    EXPECT_FALSE(armor.hasName("Maliënkolder"));
+    EXPECT_FALSE(armor.hasName("Buidel120"));
+    EXPECT_TRUE(ObjectValue(goldTemplate, 0).hasName("Buidel0"));
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "Pathfinder.h"
+#include "RoomGraph.h"
+#include "DungeonLayout.h"
+#include "Sean.h"
+
+#include <vector>
+
+class PathfinderTest : public ::testing::Test {
+protected:
+    DungeonLayout layout;
+
+    // A row of rooms 0 - 1 - 2 - 3 - 4 with exits both ways, room 5 is unreachable
+    void SetUp() override {
+        for (int i = 0; i < 6; ++i) {
+            Sean::ParsedLocations location;
+            location.mName = "Room";
+            location.mDescription = "This is a room.";
+            location.mId = i + 1;
+            layout.addRoom(location);
+        }
+        for (uint32_t room = 0; room < 4; ++room) {
+            layout.setExit(room, Sean::Direction::East, room + 1);
+            layout.setExit(room + 1, Sean::Direction::West, room);
+        }
+    }
+};
+
+TEST_F(PathfinderTest, Distances) {
+    RoomGraph graph(layout);
+    Pathfinder pathfinder;
+    const std::vector<uint32_t> &distances = pathfinder.getDistanceField(graph, {4});
+    EXPECT_EQ(distances[0], 4);
+    EXPECT_EQ(distances[3], 1);
+    EXPECT_EQ(distances[4], 0);
+    EXPECT_EQ(distances[5], Pathfinder::Unreachable);
+}
+
+TEST_F(PathfinderTest, NearestOfSeveralTargets) {
+    RoomGraph graph(layout);
+    Pathfinder pathfinder;
+    EXPECT_EQ(pathfinder.getDistance(graph, 1, {0, 4}), 1);
+    EXPECT_EQ(pathfinder.getNextStep(graph, 3, {0, 4}), 4);
+    EXPECT_EQ(pathfinder.getNextStep(graph, 4, {0, 4}), RoomGraph::NoRoom);
+}
+
+TEST_F(PathfinderTest, FindPath) {
+    RoomGraph graph(layout);
+    Pathfinder pathfinder;
+    std::vector<uint32_t> path;
+    ASSERT_TRUE(pathfinder.findPath(graph, 1, {4}, path));
+    EXPECT_EQ(path, (std::vector<uint32_t>{2, 3, 4}));
+    EXPECT_FALSE(pathfinder.findPath(graph, 5, {4}, path));
+    EXPECT_TRUE(path.empty());
+}
+
+TEST_F(PathfinderTest, FieldsAreCached) {
+    RoomGraph graph(layout);
+    Pathfinder pathfinder;
+    pathfinder.getDistance(graph, 0, {4});
+    pathfinder.getDistance(graph, 1, {4});
+    EXPECT_EQ(pathfinder.getCachedFieldCount(), 1);
+    for (uint32_t target = 0; target < 6; ++target) {
+        pathfinder.getDistance(graph, 0, {target, 5});
+    }
+    EXPECT_EQ(pathfinder.getCachedFieldCount(), 7);
+}
+
+TEST_F(PathfinderTest, ExitAddedShortensRoutes) {
+    RoomGraph graph(layout);
+    Pathfinder pathfinder;
+    pathfinder.getDistanceField(graph, {4});
+    graph.setExit(0, Sean::Direction::South, 4);
+    pathfinder.exitAdded(graph, 0, 4);
+    graph.setExit(5, Sean::Direction::North, 0);
+    pathfinder.exitAdded(graph, 5, 0);
+    EXPECT_EQ(pathfinder.getCachedFieldCount(), 1);
+    const std::vector<uint32_t> &distances = pathfinder.getDistanceField(graph, {4});
+    EXPECT_EQ(distances[0], 1);
+    EXPECT_EQ(distances[1], 2);
+    EXPECT_EQ(distances[5], 2);
+}
+
+TEST_F(PathfinderTest, ExitRemovedDropsOnlyAffectedFields) {
+    RoomGraph graph(layout);
+    Pathfinder pathfinder;
+    pathfinder.getDistanceField(graph, {4});
+    pathfinder.getDistanceField(graph, {0});
+    graph.setExit(2, Sean::Direction::East, RoomGraph::NoRoom);
+    pathfinder.exitRemoved(graph, 2, 3);
+    EXPECT_EQ(pathfinder.getCachedFieldCount(), 1);
+    EXPECT_EQ(pathfinder.getDistance(graph, 0, {4}), Pathfinder::Unreachable);
+    EXPECT_EQ(pathfinder.getDistance(graph, 4, {0}), 4);
+}
+
+TEST_F(PathfinderTest, RoomAtDistance) {
+    RoomGraph graph(layout);
+    Pathfinder pathfinder;
+    for (uint64_t random = 0; random < 4; ++random) {
+        uint32_t room = pathfinder.getRoomAtDistance(graph, 2, 2, random);
+        EXPECT_TRUE(room == 0 || room == 4);
+    }
+    EXPECT_EQ(pathfinder.getRoomAtDistance(graph, 0, 3, 0), 3);
+    // Nothing is farther than room 4, and room 5 has no exits at all
+    EXPECT_EQ(pathfinder.getRoomAtDistance(graph, 0, 10, 7), 4);
+    EXPECT_EQ(pathfinder.getRoomAtDistance(graph, 5, 1, 0), 5);
+    EXPECT_EQ(pathfinder.getCachedRingsCount(), 3);
+}
+
+TEST_F(PathfinderTest, RingsDroppedWhenExitsChange) {
+    RoomGraph graph(layout);
+    Pathfinder pathfinder;
+    EXPECT_EQ(pathfinder.getRoomAtDistance(graph, 0, 1, 0), 1);
+    graph.setExit(0, Sean::Direction::East, 5);
+    pathfinder.exitRemoved(graph, 0, 1);
+    pathfinder.exitAdded(graph, 0, 5);
+    EXPECT_EQ(pathfinder.getCachedRingsCount(), 0);
+    EXPECT_EQ(pathfinder.getRoomAtDistance(graph, 0, 1, 0), 5);
+}
\ No newline at end of file
@@ -1,33 +1,11 @@
 #include <gtest/gtest.h>
-#include <gmock/gmock.h>
 #include "Player.h"
-#include "IGameObject.h"
+#include "GoldObject.h"
+#include "ArmorObject.h"
+#include "ObjectValue.h"
+#include "WeaponObject.h"
 #include <memory>
 
-// Mock class for IGameObject
-class MockGameObject : public IGameObject
-{
-public:
-    MockGameObject() = default;
-    MockGameObject(const MockGameObject &other) : IGameObject(other)
-    {
-        // Define the copy constructor
-    }
-    MOCK_METHOD(IGameObject *, clone, (), (const, override));
-    MOCK_METHOD(Sean::String, getName, (), (const, override));
-    MOCK_METHOD(void, printName, (), (const, override));
-    MOCK_METHOD(void, printDescription, (), (const, override));
-    MOCK_METHOD(bool, isWeapon, (), (const, override));
-    MOCK_METHOD(bool, isArmor, (), (const, override));
-    MOCK_METHOD(bool, isConsumableHealth, (), (const, override));
-    MOCK_METHOD(bool, isConsumableExperience, (), (const, override));
-    MOCK_METHOD(bool, isConsumableTeleport, (), (const, override));
-    MOCK_METHOD(bool, isMoney, (), (const, override));
-    MOCK_METHOD(int, getValue, (), (const, override));
-    MOCK_METHOD(int, getMin, (), (const, override));
-    MOCK_METHOD(int, getMax, (), (const, override));
-};
-
 // Test fixture class for Player
 class PlayerTest : public ::testing::Test
 {
@@ -50,6 +28,16 @@ protected:
         std::string output = testing::internal::GetCapturedStdout();
     }
 
+    static ObjectValue makeWeapon(const char *aName, int aID)
+    {
+        return WeaponObject(aName, "Een wapen.", 10, 10, ObjectType::Weapon, aID).getObjectValue();
+    }
+
+    static ObjectValue makeArmor(const char *aName, int aID)
+    {
+        return ArmorObject(aName, "Een pantser.", 3, ObjectType::Armor, aID).getObjectValue();
+    }
+
     void TearDown() override
     {
         delete player;
@@ -78,25 +66,18 @@ TEST_F(PlayerTest, PrintDescription)
 // Test for equipObject method
 TEST_F(PlayerTest, EquipObject)
 {
-    auto mockObject = std::make_unique<MockGameObject>();
-    EXPECT_CALL(*mockObject, getName()).WillRepeatedly(::testing::Return("Sword"));
-    EXPECT_CALL(*mockObject, isWeapon()).WillRepeatedly(::testing::Return(true));
-    EXPECT_CALL(*mockObject, isMoney()).WillRepeatedly(::testing::Return(false));
-    player->addObject(std::move(mockObject));
-    auto previousItem = player->equipObject("Sword");
-    EXPECT_EQ(previousItem, nullptr);
+    player->addObject(makeWeapon("Sword", 1));
+    ObjectValue previousItem;
+    EXPECT_FALSE(player->equipObject("Sword1", previousItem));
 }
 
 // Test for removeEquippedItem method
 TEST_F(PlayerTest, RemoveEquippedItem)
 {
-    auto mockObject = std::make_unique<MockGameObject>();
-    EXPECT_CALL(*mockObject, getName()).WillRepeatedly(::testing::Return("Sword"));
-    EXPECT_CALL(*mockObject, isWeapon()).WillRepeatedly(::testing::Return(true));
-    EXPECT_CALL(*mockObject, isMoney()).WillRepeatedly(::testing::Return(false));
-    player->addObject(std::move(mockObject));
-    player->equipObject("Sword");
-    player->removeEquippedItem(player->getInventory().front().get());
+    player->addObject(makeWeapon("Sword", 1));
+    ObjectValue previousItem;
+    player->equipObject("Sword1", previousItem);
+    player->removeEquippedItem(&player->getInventory().front());
     EXPECT_EQ(player->getInventory().size(), 0);
 }
 
@@ -119,35 +100,43 @@ TEST_F(PlayerTest, AddExperience)
 // Test for addObject method
 TEST_F(PlayerTest, AddObject)
 {
-    auto mockObject = std::make_unique<MockGameObject>();
-    EXPECT_CALL(*mockObject, isMoney()).WillRepeatedly(::testing::Return(true));
-    EXPECT_CALL(*mockObject, getValue()).WillRepeatedly(::testing::Return(50));
-    player->addObject(std::move(mockObject));
+    player->addObject(GoldObject("Buidel", "Een buidel met munten.", 50, 50, ObjectType::Gold, 1).getObjectValue());
     EXPECT_EQ(player->getGold(), 50);
+    EXPECT_EQ(player->getInventory().size(), 0);
 }
 
 // Test for printObject method
 TEST_F(PlayerTest, PrintObject)
 {
-    auto mockObject = std::make_unique<MockGameObject>();
-    EXPECT_CALL(*mockObject, getName()).WillRepeatedly(::testing::Return("Sword"));
-    EXPECT_CALL(*mockObject, isMoney()).WillRepeatedly(::testing::Return(false));
-    EXPECT_CALL(*mockObject, printName()).Times(1);
-    EXPECT_CALL(*mockObject, printDescription()).Times(1);
-    player->addObject(std::move(mockObject));
-    EXPECT_TRUE(player->printObject("Sword"));
+    player->addObject(makeWeapon("Sword", 1));
+    testing::internal::CaptureStdout();
+    EXPECT_TRUE(player->printObject("Sword1"));
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, "Sword1\nEen wapen.\nSchade tussen: 10 - 10\n");
 }
 
 // Test for dropObject method
 TEST_F(PlayerTest, DropObject)
 {
-    auto mockObject = std::make_unique<MockGameObject>();
-    EXPECT_CALL(*mockObject, getName()).WillRepeatedly(::testing::Return("Sword"));
-    EXPECT_CALL(*mockObject, isMoney()).WillRepeatedly(::testing::Return(false));
-    player->addObject(std::move(mockObject));
-    auto droppedItem = player->dropObject("Sword");
-    EXPECT_NE(droppedItem, nullptr);
+    player->addObject(makeWeapon("Sword", 1));
+    ObjectValue droppedItem;
+    EXPECT_TRUE(player->dropObject("Sword1", droppedItem));
+    EXPECT_EQ(droppedItem.getName(), "Sword1");
     EXPECT_EQ(player->getInventory().size(), 0);
+    EXPECT_FALSE(player->dropObject("Sword1", droppedItem));
+}
+
+// Test for removeObject method
+TEST_F(PlayerTest, RemoveObject)
+{
+    player->addObject(makeWeapon("Sword", 1));
+    player->addObject(makeWeapon("Axe", 2));
+    ObjectValue outside = makeWeapon("Bow", 3);
+    EXPECT_FALSE(player->removeObject(&outside));
+    EXPECT_TRUE(player->removeObject(player->findObject("Sword1")));
+    ASSERT_EQ(player->getInventory().size(), 1);
+    EXPECT_EQ(player->findObject("Sword1"), nullptr);
+    EXPECT_NE(player->findObject("Axe2"), nullptr);
 }
 
 // Test for toggleGodMode method
@@ -183,13 +172,9 @@ TEST_F(PlayerTest, GetAttackPercentage)
 // Test for getAttackDamage method
 TEST_F(PlayerTest, GetAttackDamage)
 {
-    auto mockObject = std::make_unique<MockGameObject>();
-    EXPECT_CALL(*mockObject, getName()).WillRepeatedly(::testing::Return("Sword"));
-    EXPECT_CALL(*mockObject, isWeapon()).WillRepeatedly(::testing::Return(true));
-    EXPECT_CALL(*mockObject, getValue()).WillRepeatedly(::testing::Return(10));
-    EXPECT_CALL(*mockObject, isMoney()).WillRepeatedly(::testing::Return(false));
-    player->addObject(std::move(mockObject));
-    player->equipObject("Sword");
+    player->addObject(makeWeapon("Sword", 1));
+    ObjectValue previousItem;
+    player->equipObject("Sword1", previousItem);
     int attackDamage = player->getAttackDamage();
     EXPECT_GE(attackDamage, 0);
     EXPECT_LE(attackDamage, 10);
@@ -218,52 +203,68 @@ TEST_F(PlayerTest, GetName)
 // Test for equipping and removing weapon
 TEST_F(PlayerTest, EquipAndRemoveWeapon)
 {
-    auto mockWeapon = std::make_unique<MockGameObject>();
-    auto mockWeapon2 = std::make_unique<MockGameObject>();
-    EXPECT_CALL(*mockWeapon, getName()).WillRepeatedly(::testing::Return("Sword"));
-    EXPECT_CALL(*mockWeapon, isWeapon()).WillRepeatedly(::testing::Return(true));
-    EXPECT_CALL(*mockWeapon, isMoney()).WillRepeatedly(::testing::Return(false));
-    EXPECT_CALL(*mockWeapon, clone()).WillRepeatedly(::testing::Return(new MockGameObject(*mockWeapon)));
-    EXPECT_CALL(*mockWeapon2, getName()).WillRepeatedly(::testing::Return("Axe"));
-    EXPECT_CALL(*mockWeapon2, isWeapon()).WillRepeatedly(::testing::Return(true));
-    EXPECT_CALL(*mockWeapon2, isMoney()).WillRepeatedly(::testing::Return(false));
-    EXPECT_CALL(*mockWeapon2, clone()).WillRepeatedly(::testing::Return(new MockGameObject(*mockWeapon2)));
-    player->addObject(std::move(mockWeapon));
-    player->addObject(std::move(mockWeapon2));
-    auto previousItem = player->equipObject("Sword");
-    EXPECT_EQ(previousItem, nullptr);
+    player->addObject(makeWeapon("Sword", 1));
+    player->addObject(makeWeapon("Axe", 2));
+    ObjectValue previousItem;
+    EXPECT_FALSE(player->equipObject("Sword1", previousItem));
     EXPECT_EQ(player->getInventory().size(), 2);
-    EXPECT_EQ(player->equipObject("Sword"), nullptr);
-    auto previousItem2 = player->equipObject("Axe");
-    EXPECT_NE(previousItem2, nullptr);
+    EXPECT_FALSE(player->equipObject("Sword1", previousItem));
+    EXPECT_TRUE(player->equipObject("Axe2", previousItem));
+    EXPECT_EQ(previousItem.getName(), "Sword1");
     EXPECT_EQ(player->getInventory().size(), 1);
 }
 
 // Test for equipping and removing armor
 TEST_F(PlayerTest, EquipAndRemoveArmor)
 {
-    auto mockArmor = std::make_unique<MockGameObject>();
-    auto mockArmor2 = std::make_unique<MockGameObject>();
-
-    EXPECT_CALL(*mockArmor, getName()).WillRepeatedly(::testing::Return("Shield"));
-    EXPECT_CALL(*mockArmor, isArmor()).WillRepeatedly(::testing::Return(true));
-    EXPECT_CALL(*mockArmor, isMoney()).WillRepeatedly(::testing::Return(false));
-    EXPECT_CALL(*mockArmor, isWeapon()).WillRepeatedly(::testing::Return(false));
-    EXPECT_CALL(*mockArmor, clone()).WillRepeatedly(::testing::Return(new MockGameObject(*mockArmor)));
-
-    EXPECT_CALL(*mockArmor2, getName()).WillRepeatedly(::testing::Return("Helmet"));
-    EXPECT_CALL(*mockArmor2, isArmor()).WillRepeatedly(::testing::Return(true));
-    EXPECT_CALL(*mockArmor2, isMoney()).WillRepeatedly(::testing::Return(false));
-    EXPECT_CALL(*mockArmor2, isWeapon()).WillRepeatedly(::testing::Return(false));
-    EXPECT_CALL(*mockArmor2, clone()).WillRepeatedly(::testing::Return(new MockGameObject(*mockArmor2)));
-
-    player->addObject(std::move(mockArmor));
-    player->addObject(std::move(mockArmor2));
-    auto previousItem = player->equipObject("Shield");
-    EXPECT_EQ(previousItem, nullptr);
+    player->addObject(makeArmor("Shield", 1));
+    player->addObject(makeArmor("Helmet", 2));
+    ObjectValue previousItem;
+    EXPECT_FALSE(player->equipObject("Shield1", previousItem));
     EXPECT_EQ(player->getInventory().size(), 2);
-    EXPECT_EQ(player->equipObject("Shield"), nullptr);
-    auto previousItem2 = player->equipObject("Helmet");
-    EXPECT_NE(previousItem2, nullptr);
+    EXPECT_FALSE(player->equipObject("Shield1", previousItem));
+    EXPECT_TRUE(player->equipObject("Helmet2", previousItem));
+    EXPECT_EQ(previousItem.getName(), "Shield1");
     EXPECT_EQ(player->getInventory().size(), 1);
+}
+
+// Test for the equip slots following items that move within the inventory
+TEST_F(PlayerTest, EquipSlotsFollowMovedItems)
+{
+    for (int i = 0; i < 100; ++i)
+    {
+        player->addObject(WeaponObject("zwaard", "Een zwaard.", 1, 4, ObjectType::Weapon, i).getObjectValue());
+    }
+    player->addObject(ArmorObject("harnas", "Een harnas.", 3, ObjectType::Armor, 100).getObjectValue());
+
+    testing::internal::CaptureStdout();
+    ObjectValue previousItem;
+    EXPECT_FALSE(player->equipObject("zwaard99", previousItem));
+    EXPECT_FALSE(player->equipObject("harnas100", previousItem));
+    bool replaced = player->equipObject("zwaard0", previousItem);
+    testing::internal::GetCapturedStdout();
+
+    // The previous weapon is moved out, not cloned, and the armor moved into its slot
+    ASSERT_TRUE(replaced);
+    EXPECT_EQ(previousItem.getName(), "zwaard99");
+    EXPECT_EQ(player->getInventory().size(), 100u);
+    EXPECT_EQ(player->findObject("zwaard99"), nullptr);
+    ASSERT_NE(player->findObject("harnas100"), nullptr);
+    EXPECT_TRUE(player->findObject("harnas100")->isArmor());
+
+    player->addHealth(-5);
+    EXPECT_EQ(player->getHealth(), 18);
+
+    ObjectValue droppedItem;
+    ASSERT_TRUE(player->dropObject("harnas100", droppedItem));
+    player->addHealth(-5);
+    EXPECT_EQ(player->getHealth(), 13);
+
+    for (int i = 1; i < 99; ++i)
+    {
+        EXPECT_TRUE(player->dropObject(("zwaard" + std::to_string(i)).c_str(), droppedItem));
+    }
+    ASSERT_EQ(player->getInventory().size(), 1u);
+    EXPECT_EQ(player->getInventory().front().getName(), "zwaard0");
+    EXPECT_GE(player->getAttackDamage(), 0);
 }
\ No newline at end of file
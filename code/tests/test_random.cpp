@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "RandomGenerator.h"
+
+#include <thread>
+#include <vector>
+
+TEST(RandomGeneratorTest, SeedRepeatsValues) {
+    RandomGenerator random;
+    RandomGenerator::seed(42);
+    uint64_t first = random.next();
+    int second = random.getRandomValue(1, 6);
+    RandomGenerator::seed(42);
+    EXPECT_EQ(random.next(), first);
+    EXPECT_EQ(random.getRandomValue(1, 6), second);
+}
+
+TEST(RandomGeneratorTest, ValuesStayInRange) {
+    RandomGenerator random;
+    RandomGenerator::seed(7);
+    std::vector<int> counts(6, 0);
+    for (int i = 0; i < 60000; ++i) {
+        int value = random.getRandomValue(1, 6);
+        ASSERT_GE(value, 1);
+        ASSERT_LE(value, 6);
+        ++counts[value - 1];
+    }
+    for (int count : counts) {
+        EXPECT_NEAR(count, 10000, 500);
+    }
+    EXPECT_EQ(random.getRandomValue(5, 5), 5);
+    EXPECT_EQ(random.getRandomValue(5, 2), 5);
+    int extreme = random.getRandomValue(INT32_MIN, INT32_MAX);
+    EXPECT_GE(extreme, INT32_MIN);
+    EXPECT_FALSE(random.getChance(0));
+    EXPECT_TRUE(random.getChance(100));
+    EXPECT_FALSE(random.getChance(101));
+}
+
+TEST(RandomGeneratorTest, BatchFillMatchesSingleDraws) {
+    RandomGenerator random;
+    std::vector<int> batch(100);
+    RandomGenerator::seed(3);
+    random.fillRandomValues(batch.data(), batch.size(), -10, 10);
+    RandomGenerator::seed(3);
+    for (int value : batch) {
+        EXPECT_EQ(value, random.getRandomValue(-10, 10));
+    }
+
+    std::vector<uint64_t> raw(4);
+    RandomGenerator::seed(3);
+    random.fill(raw.data(), raw.size());
+    RandomGenerator::seed(3);
+    for (uint64_t value : raw) {
+        EXPECT_EQ(value, random.next());
+    }
+}
+
+TEST(RandomGeneratorTest, ThreadsHaveOwnEngines) {
+    RandomGenerator::seed(11);
+    std::vector<uint64_t> values(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < values.size(); ++t) {
+        threads.emplace_back([&values, t]() {
+            RandomGenerator random;
+            RandomGenerator::seed(11);
+            for (int i = 0; i < 1000; ++i) {
+                values[t] = random.next();
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (uint64_t value : values) {
+        EXPECT_EQ(value, values[0]);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "RoomGraph.h"
+#include "DungeonLayout.h"
+#include "Sean.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+class RoomGraphTest : public ::testing::Test {
+protected:
+    DungeonLayout layout;
+
+    void SetUp() override {
+        const char *names[] = {"Main Room", "North Room", "East Room", "South Room", "West Room"};
+        for (int i = 0; i < 5; ++i) {
+            Sean::ParsedLocations location;
+            location.mName = names[i];
+            location.mDescription = "This is a room.";
+            location.mId = i + 1;
+            layout.addRoom(location);
+        }
+    }
+
+    std::string printExits(uint32_t aRoom) {
+        RoomGraph graph(layout);
+        testing::internal::CaptureStdout();
+        graph.printExits(aRoom);
+        return testing::internal::GetCapturedStdout();
+    }
+};
+
+TEST_F(RoomGraphTest, PrintExits_NoExits) {
+    EXPECT_EQ(printExits(0), "Uitgangen: \n");
+}
+
+TEST_F(RoomGraphTest, PrintExits_NorthExit) {
+    layout.setExit(0, Sean::Direction::North, 1);
+    EXPECT_EQ(printExits(0), "Uitgangen: noord \n");
+}
+
+TEST_F(RoomGraphTest, PrintExits_EastExit) {
+    layout.setExit(0, Sean::Direction::East, 2);
+    EXPECT_EQ(printExits(0), "Uitgangen: oost \n");
+}
+
+TEST_F(RoomGraphTest, PrintExits_SouthExit) {
+    layout.setExit(0, Sean::Direction::South, 3);
+    EXPECT_EQ(printExits(0), "Uitgangen: zuid \n");
+}
+
+TEST_F(RoomGraphTest, PrintExits_WestExit) {
+    layout.setExit(0, Sean::Direction::West, 4);
+    EXPECT_EQ(printExits(0), "Uitgangen: west \n");
+}
+
+TEST_F(RoomGraphTest, PrintExits_MultipleExits) {
+    layout.setExit(0, Sean::Direction::North, 1);
+    layout.setExit(0, Sean::Direction::East, 2);
+    EXPECT_EQ(printExits(0), "Uitgangen: noord oost \n");
+}
+
+TEST_F(RoomGraphTest, GetExit) {
+    layout.setExit(0, Sean::Direction::North, 1);
+    RoomGraph graph(layout);
+    EXPECT_EQ(graph.getExit(0, Sean::Direction::North), 1);
+    EXPECT_EQ(graph.getExit(0, Sean::Direction::South), RoomGraph::NoRoom);
+    EXPECT_EQ(graph.getExit(0, Sean::Direction::Invalid), RoomGraph::NoRoom);
+}
+
+TEST_F(RoomGraphTest, Neighbours) {
+    layout.setExit(0, Sean::Direction::West, 4);
+    layout.setExit(0, Sean::Direction::North, 1);
+    layout.setExit(3, Sean::Direction::East, 0);
+    RoomGraph graph(layout);
+    ASSERT_EQ(graph.getRoomCount(), 5);
+    ASSERT_EQ(graph.getNeighbourCount(0), 2);
+    EXPECT_EQ(graph.getNeighbours(0)[0], 1);
+    EXPECT_EQ(graph.getNeighbours(0)[1], 4);
+    EXPECT_EQ(graph.getNeighbourCount(1), 0);
+    ASSERT_EQ(graph.getNeighbourCount(3), 1);
+    EXPECT_EQ(graph.getNeighbours(3)[0], 0);
+}
+
+TEST_F(RoomGraphTest, Predecessors) {
+    layout.setExit(0, Sean::Direction::North, 1);
+    layout.setExit(3, Sean::Direction::East, 1);
+    RoomGraph graph(layout);
+    ASSERT_EQ(graph.getPredecessorCount(1), 2);
+    EXPECT_EQ(graph.getPredecessors(1)[0], 0);
+    EXPECT_EQ(graph.getPredecessors(1)[1], 3);
+    EXPECT_EQ(graph.getPredecessorCount(0), 0);
+}
+
+TEST_F(RoomGraphTest, SetExit) {
+    layout.setExit(0, Sean::Direction::North, 1);
+    RoomGraph graph(layout);
+    graph.setExit(0, Sean::Direction::North, RoomGraph::NoRoom);
+    graph.setExit(2, Sean::Direction::South, 0);
+    EXPECT_EQ(graph.getNeighbourCount(0), 0);
+    EXPECT_EQ(graph.getPredecessorCount(1), 0);
+    ASSERT_EQ(graph.getPredecessorCount(0), 1);
+    EXPECT_EQ(graph.getPredecessors(0)[0], 2);
+    EXPECT_THROW(graph.setExit(5, Sean::Direction::North, 0), std::out_of_range);
+}
+TEST_F(RoomGraphTest, ManyChangesMatchFreshGraph) {
+    const uint32_t rooms = 200;
+    std::vector<uint32_t> exits(rooms * RoomGraph::ExitsPerRoom, RoomGraph::NoRoom);
+    RoomGraph graph(exits);
+    // Enough changes to fill the overlay and pack it again, with some rooms leading to the same room twice
+    for (uint32_t change = 0; change < 1000; ++change) {
+        uint32_t room = (change * 37) % rooms;
+        uint32_t direction = change % RoomGraph::ExitsPerRoom;
+        uint32_t target = change % 7 == 0 ? RoomGraph::NoRoom : (change * 13) % 20;
+        graph.setExit(room, static_cast<Sean::Direction>(direction), target);
+        exits[room * RoomGraph::ExitsPerRoom + direction] = target;
+
+        if (change % 97 == 0 || change == 999) {
+            RoomGraph fresh(exits);
+            for (uint32_t r = 0; r < rooms; ++r) {
+                std::vector<uint32_t> neighbours(graph.getNeighbours(r), graph.getNeighbours(r) + graph.getNeighbourCount(r));
+                std::vector<uint32_t> expectedNeighbours(fresh.getNeighbours(r), fresh.getNeighbours(r) + fresh.getNeighbourCount(r));
+                EXPECT_EQ(neighbours, expectedNeighbours);
+                std::vector<uint32_t> predecessors(graph.getPredecessors(r), graph.getPredecessors(r) + graph.getPredecessorCount(r));
+                std::vector<uint32_t> expectedPredecessors(fresh.getPredecessors(r), fresh.getPredecessors(r) + fresh.getPredecessorCount(r));
+                std::sort(predecessors.begin(), predecessors.end());
+                EXPECT_EQ(predecessors, expectedPredecessors);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "SaveGame.h"
+#include "Dungeon.h"
+#include "Player.h"
+#include "GameObjectFactory.h"
+#include "Sean.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+class SaveGameTest : public ::testing::Test {
+protected:
+    std::string savePath;
+    std::streambuf *orig_cin;
+    std::istringstream input;
+
+    void SetUp() override {
+        savePath = (std::filesystem::temp_directory_path() / "test_kerker.sav").string();
+        orig_cin = std::cin.rdbuf();
+        input.str("Speler\nAnder\n");
+        std::cin.rdbuf(input.rdbuf());
+    }
+
+    void TearDown() override {
+        std::cin.rdbuf(orig_cin);
+        std::remove(savePath.c_str());
+    }
+
+    std::string describe(Player &aPlayer) {
+        testing::internal::CaptureStdout();
+        aPlayer.printDescription();
+        return testing::internal::GetCapturedStdout();
+    }
+
+    std::string describe(const Dungeon &aDungeon) {
+        testing::internal::CaptureStdout();
+        aDungeon.printLongDescription();
+        return testing::internal::GetCapturedStdout();
+    }
+};
+
+TEST_F(SaveGameTest, RoundTrip) {
+    testing::internal::CaptureStdout();
+    Dungeon dungeon(100);
+    Player player;
+    std::unique_ptr<GameObject> dolk(GameObjectFactory::createGameObject("dolk"));
+    ObjectValue previousItem;
+    player.addObject(dolk->getObjectValue());
+    player.equipObject(player.getInventory()[0].getName().c_str(), previousItem);
+    testing::internal::GetCapturedStdout();
+    player.addHealth(-3);
+    dungeon.teleport(3);
+    dungeon.update();
+
+    SaveGame(savePath.c_str()).save(dungeon, player);
+    ASSERT_TRUE(SaveGame::isSaveFile(savePath.c_str()));
+
+    testing::internal::CaptureStdout();
+    Player restoredPlayer;
+    testing::internal::GetCapturedStdout();
+    std::unique_ptr<Dungeon> restored = SaveGame(savePath.c_str()).load(restoredPlayer);
+    EXPECT_EQ(restored->getCurrentRoom(), dungeon.getCurrentRoom());
+    EXPECT_EQ(restored->getTurn(), dungeon.getTurn());
+    EXPECT_EQ(restored->getMaterializedCount(), dungeon.getMaterializedCount());
+    ASSERT_EQ(restored->getEntities().getEntityCount(), dungeon.getEntities().getEntityCount());
+    for (EntityStore::EntityId enemy = 0; enemy < dungeon.getEntities().getEntityCount(); ++enemy) {
+        EXPECT_EQ(restored->getEntities().getName(enemy), dungeon.getEntities().getName(enemy));
+        EXPECT_EQ(restored->getEntities().getHealth(enemy), dungeon.getEntities().getHealth(enemy));
+        EXPECT_EQ(restored->getEntities().getPosition(enemy), dungeon.getEntities().getPosition(enemy));
+    }
+    EXPECT_EQ(describe(*restored), describe(dungeon));
+    EXPECT_EQ(describe(restoredPlayer), describe(player));
+    EXPECT_EQ(restoredPlayer.getName(), "Speler");
+
+    // Saving the restored game gives the same file
+    std::string secondPath = savePath + "2";
+    SaveGame(secondPath.c_str()).save(*restored, restoredPlayer);
+    std::ifstream first(savePath, std::ios::binary);
+    std::ifstream second(secondPath, std::ios::binary);
+    std::stringstream firstBytes;
+    std::stringstream secondBytes;
+    firstBytes << first.rdbuf();
+    secondBytes << second.rdbuf();
+    std::remove(secondPath.c_str());
+    EXPECT_EQ(firstBytes.str(), secondBytes.str());
+}
+
+TEST_F(SaveGameTest, LargeDungeonSavesQuickly) {
+    testing::internal::CaptureStdout();
+    Dungeon dungeon(100000);
+    Player player;
+    testing::internal::GetCapturedStdout();
+
+    auto start = std::chrono::steady_clock::now();
+    SaveGame(savePath.c_str()).save(dungeon, player);
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(duration.count(), 500.0);
+
+    testing::internal::CaptureStdout();
+    Player restoredPlayer;
+    testing::internal::GetCapturedStdout();
+    std::unique_ptr<Dungeon> restored = SaveGame(savePath.c_str()).load(restoredPlayer);
+    EXPECT_EQ(restored->getCurrentRoom(), 0);
+}
+
+TEST_F(SaveGameTest, InvalidFile) {
+    std::ofstream(savePath, std::ios::binary) << "KSAV broken";
+    testing::internal::CaptureStdout();
+    Player player;
+    testing::internal::GetCapturedStdout();
+    EXPECT_THROW(SaveGame(savePath.c_str()).load(player), std::runtime_error);
+    EXPECT_EQ(player.getName(), "Speler");
+    EXPECT_FALSE(SaveGame::isSaveFile("/nonexistent/file.sav"));
+}
+TEST_F(SaveGameTest, ChangedExitsAreSaved) {
+    testing::internal::CaptureStdout();
+    Dungeon dungeon(100);
+    Player player;
+    testing::internal::GetCapturedStdout();
+    dungeon.setExit(5, Sean::Direction::East, 42);
+    SaveGame(savePath.c_str()).save(dungeon, player);
+
+    testing::internal::CaptureStdout();
+    Player restoredPlayer;
+    testing::internal::GetCapturedStdout();
+    std::unique_ptr<Dungeon> restored = SaveGame(savePath.c_str()).load(restoredPlayer);
+    EXPECT_EQ(restored->getDistance(5, 42), 1);
+    EXPECT_EQ(restored->getNextStep(5, 42), 42);
+}
\ No newline at end of file
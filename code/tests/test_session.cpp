@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "SessionRecorder.h"
+#include "SessionReplay.h"
+#include "DungeonGenerator.h"
+#include "MovementScheduler.h"
+#include "RandomGenerator.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <sstream>
+#include <string>
+
+class SessionTest : public ::testing::Test {
+protected:
+    std::string sessionPath;
+
+    void SetUp() override {
+        sessionPath = (std::filesystem::temp_directory_path() / "test_sessie.rec").string();
+    }
+
+    void TearDown() override {
+        std::remove(sessionPath.c_str());
+    }
+
+    std::string readAll(std::streambuf *aBuf) {
+        std::ostringstream text;
+        text << aBuf;
+        return text.str();
+    }
+};
+
+TEST_F(SessionTest, ReplaysRecordedInput) {
+    std::stringbuf console("genereren\n25\nSpeler\nkijk\nga noord\nquit\n");
+    {
+        SessionRecorder recorder(sessionPath.c_str(), 1234, &console);
+        std::istream input(recorder.getInputBuf());
+        std::string word;
+        int locations;
+        input >> word >> locations;
+        recorder.recordSource(BinaryFormat::SessionSource::Generated, std::to_string(locations));
+        input >> word;
+        input.ignore(1);
+        std::string line;
+        while (std::getline(input, line) && line != "ga noord") {
+        }
+    }
+
+    SessionReplay replay(sessionPath.c_str());
+    EXPECT_EQ(replay.getSeed(), 1234u);
+    EXPECT_EQ(replay.getSource(), BinaryFormat::SessionSource::Generated);
+    EXPECT_EQ(replay.getSourceText(), "25");
+    EXPECT_EQ(replay.getInputCount(), 5u);
+    EXPECT_EQ(readAll(replay.getInputBuf()), "genereren\n25\nSpeler\nkijk\nga noord\n");
+}
+
+TEST_F(SessionTest, KeepsUnfinishedLine) {
+    std::stringbuf console("laden\nkijk");
+    {
+        SessionRecorder recorder(sessionPath.c_str(), 1, &console);
+        readAll(recorder.getInputBuf());
+    }
+
+    SessionReplay replay(sessionPath.c_str());
+    EXPECT_EQ(replay.getSource(), BinaryFormat::SessionSource::None);
+    EXPECT_EQ(replay.getInputCount(), 2u);
+    EXPECT_EQ(readAll(replay.getInputBuf()), "laden\nkijk");
+}
+
+TEST_F(SessionTest, IgnoresTruncatedRecord) {
+    std::stringbuf console("kijk\nquit\n");
+    {
+        SessionRecorder recorder(sessionPath.c_str(), 1, &console);
+        readAll(recorder.getInputBuf());
+    }
+    std::filesystem::resize_file(sessionPath, std::filesystem::file_size(sessionPath) - 2);
+
+    SessionReplay replay(sessionPath.c_str());
+    EXPECT_EQ(replay.getInputCount(), 1u);
+    EXPECT_EQ(readAll(replay.getInputBuf()), "kijk\n");
+}
+
+TEST_F(SessionTest, RejectsOtherFiles) {
+    {
+        std::ofstream file(sessionPath, std::ios_base::binary);
+        file << "geen opgenomen sessie";
+    }
+    EXPECT_THROW(SessionReplay(sessionPath.c_str()), std::runtime_error);
+    EXPECT_THROW(SessionReplay("bestaat_niet.rec"), std::runtime_error);
+}
+
+TEST_F(SessionTest, SeedFixesDungeonAndMovement) {
+    RandomGenerator::seed(99);
+    DungeonGenerator::Settings firstSettings(10);
+    MovementScheduler firstScheduler;
+    RandomGenerator::seed(99);
+    DungeonGenerator::Settings secondSettings(10);
+    MovementScheduler secondScheduler;
+
+    EXPECT_EQ(firstSettings.mSeed, secondSettings.mSeed);
+    EXPECT_EQ(firstScheduler.getSeed(), secondScheduler.getSeed());
+    EXPECT_NE(firstSettings.mSeed, firstScheduler.getSeed());
+}
\ No newline at end of file
@@ -151,3 +151,13 @@ TEST_F(SQLReaderTest, GetObjectAmount_InvalidName) {
 
     EXPECT_FALSE(result);
 }
+
+
+TEST_F(SQLReaderTest, GetAllObjectTypes) {
+    Sean::Vector<Sean::String> names;
+
+    bool result = sqlReader.getAllObjectTypes(names);
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(names.size(), 6u);
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "EventReader.h"
+
+/**
+ * @brief Quotes a CSV field if it contains a separator, quote or line break.
+ *
+ * @param aField The field.
+ * @return std::string The field as it is written to the CSV.
+ */
+static std::string quoteCsv(const std::string &aField)
+{
+    if (aField.find_first_of(",\"\r\n") == std::string::npos)
+    {
+        return aField;
+    }
+    std::string quoted = "\"";
+    for (char c : aField)
+    {
+        if (c == '"')
+        {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+/**
+ * @brief Writes a time as local date and time with microseconds.
+ *
+ * @param aTime Microseconds since the Unix epoch.
+ */
+static void printTime(uint64_t aTime)
+{
+    std::time_t seconds = static_cast<std::time_t>(aTime / 1000000);
+    std::tm tm;
+    localtime_r(&seconds, &tm);
+    std::cout << std::put_time(&tm, "%Y-%m-%d %H:%M:%S") << '.' << std::setw(6) << std::setfill('0') << aTime % 1000000 << std::setfill(' ');
+}
+
+/**
+ * @brief Renders an event log of the game as text or CSV.
+ *
+ * Usage: eventlog <events.evt> [--csv]
+ */
+int main(int argc, char **argv)
+{
+    bool csv = argc == 3 && std::string(argv[2]) == "--csv";
+    if (argc != 2 && !csv)
+    {
+        std::cerr << "Usage: " << argv[0] << " <events.evt> [--csv]" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        EventReader reader(argv[1]);
+        EventReader::Event event;
+        if (csv)
+        {
+            std::cout << "time_us,offset_us,event,field1,field2" << '\n';
+        }
+        while (reader.next(event))
+        {
+            uint64_t offset = event.mTime - reader.getStartTime();
+            if (csv)
+            {
+                std::cout << event.mTime << ',' << offset << ',' << EventReader::getTypeName(event.mType);
+                for (size_t field = 0; field < 2; ++field)
+                {
+                    std::cout << ',' << (field < event.mFields.size() ? quoteCsv(event.mFields[field]) : "");
+                }
+            }
+            else
+            {
+                printTime(event.mTime);
+                std::cout << " +" << std::fixed << std::setprecision(6) << offset / 1000000.0 << "s " << EventReader::getTypeName(event.mType);
+                for (const std::string &field : event.mFields)
+                {
+                    std::cout << ' ' << field;
+                }
+            }
+            std::cout << '\n';
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <iostream>
+#include <string>
+
+#include "DungeonGenerator.h"
+#include "BinaryWriter.h"
+
+/**
+ * @brief Generates a random dungeon in the compiled binary format.
+ *
+ * Usage: gendungeon <locations> <output.bin> [seed]
+ */
+int main(int argc, char **argv)
+{
+    if (argc != 3 && argc != 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " <locations> <output.bin> [seed]" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        DungeonGenerator::Settings settings(static_cast<uint32_t>(std::stoul(argv[1])));
+        if (argc == 4)
+        {
+            settings.mSeed = std::stoull(argv[3]);
+        }
+
+        DungeonGenerator generator(settings);
+        DungeonLayout layout = generator.generate();
+        BinaryWriter binaryWriter(argv[2]);
+        binaryWriter.write(layout);
+
+        for (const DungeonGenerator::PhaseTiming &timing : generator.getTimings())
+        {
+            std::cout << timing.mName << ": " << timing.mMilliseconds << " ms" << std::endl;
+        }
+        std::cout << "Generated " << layout.getRoomCount() << " locations to " << argv[2] << std::endl;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
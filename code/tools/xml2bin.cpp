@@ -0,0 +1,35 @@
+#include <iostream>
+
+#include "XmlReader.h"
+#include "DungeonLayout.h"
+#include "BinaryWriter.h"
+
+/**
+ * @brief Converts an XML dungeon to the compiled binary format.
+ *
+ * Usage: xml2bin <input.xml> <output.bin>
+ */
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input.xml> <output.bin>" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        XmlReader xmlReader(argv[1]);
+        DungeonLayout layout(xmlReader.getLocations());
+        BinaryWriter binaryWriter(argv[2]);
+        binaryWriter.write(layout);
+        std::cout << "Converted " << layout.getRoomCount() << " locations to " << argv[2] << std::endl;
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file